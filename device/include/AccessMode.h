@@ -33,7 +33,30 @@ namespace ChimeraTK {
      * Make any read blocking until new data has arrived since the last read. This flag may not be suppoerted by all
      * registers (and backends), in which case a DeviceException with the id NOT_IMPLEMENTED will be thrown.
      */
-    wait_for_new_data
+    wait_for_new_data,
+
+    /**
+     * Zero-copy access, only allowed in combination with AccessMode::raw: the data is transferred directly between the
+     * device and the user buffer of the accessor, without an intermediate copy into a transfer buffer.
+     *
+     * Support by backend: the flag is supported by the scalar and 1D registers of all NumericAddressedBackends (e.g.
+     * pci, xdma, uio, rebot, dummy and sharedMemoryDummy). If direct transfer is not possible for the given register
+     * (because the access needs alignment padding), these backends fall back to the normal copying transfer, which
+     * does not change the observable content of the user buffer. All other backends, and 2D registers of the
+     * NumericAddressedBackends, reject the flag with a ChimeraTK::logic_error when the accessor is created. The flag
+     * cannot be combined with AccessMode::wait_for_new_data, since that data is delivered through a queue.
+     *
+     * Ownership and swapping: the user buffer remains owned by the accessor resp. the user. It may be swapped with
+     * another buffer of the same size between transfers, since the location of the buffer is determined anew at the
+     * beginning of each transfer. The buffer must not be swapped or resized while a transfer is in progress (i.e.
+     * between preRead()/preWrite() and the corresponding postRead()/postWrite()).
+     *
+     * Exceptions: since the device writes directly into the user buffer, a read which fails with a
+     * ChimeraTK::runtime_error may leave the user buffer partially overwritten. This is the only deviation from the
+     * usual guarantee that a failed read leaves the user buffer untouched. To keep that guarantee for all other
+     * accessors, accessors with this flag cannot be added to a TransferGroup (a ChimeraTK::logic_error is thrown).
+     */
+    zero_copy
 
     /* IMPORTANT: When extending this class with new flags, don't forget to update AccessModeFlags::getStringMap()! */
   };
@@ -4,6 +4,7 @@
 
 #include "AccessMode.h"
 #include "DeviceBackend.h"
+#include "DeviceBackendImpl.h"
 #include "ForwardDeclarations.h"
 #include "OneDRegisterAccessor.h"
 #include "ScalarRegisterAccessor.h"
@@ -193,6 +194,22 @@ namespace ChimeraTK {
      */
     void setException(const std::string& message);
 
+    /**
+     * Enable recording of transfer statistics (counts, bytes and latency histograms) for all register accessors
+     * obtained from this device afterwards. The statistics can be queried per accessor with
+     * TransferElementAbstractor::getTransferStatistics() and aggregated for the entire device with
+     * getTransferStatistics(). Without this call, the accessors have no measurable overhead.
+     *
+     * This function must be called before the accessors of interest are created.
+     */
+    void enableTransferStatistics();
+
+    /**
+     * Return the transfer statistics aggregated over all register accessors of this device, or a nullptr if
+     * enableTransferStatistics() has not been called.
+     */
+    [[nodiscard]] boost::shared_ptr<TransferStatistics> getTransferStatistics() const;
+
     /**
      * Obtain the backend.
      *
@@ -255,6 +272,14 @@ namespace ChimeraTK {
     boost::shared_ptr<DeviceBackend> _deviceBackendPointer;
 
     void checkPointersAreNotNull() const;
+
+    /**
+     * Attach TransferStatistics to an accessor handed out to the user, if the backend supports them. See
+     * DeviceBackendImpl::attachTransferStatistics().
+     */
+    template<typename UserType>
+    boost::shared_ptr<NDRegisterAccessor<UserType>> attachTransferStatistics(
+        const boost::shared_ptr<NDRegisterAccessor<UserType>>& accessor) const;
   };
 
   /********************************************************************************************************************/
@@ -263,8 +288,9 @@ namespace ChimeraTK {
   ScalarRegisterAccessor<UserType> Device::getScalarRegisterAccessor(
       const RegisterPath& registerPathName, size_t wordOffsetInRegister, const AccessModeFlags& flags) const {
     checkPointersAreNotNull();
-    return ScalarRegisterAccessor<UserType>(
-        _deviceBackendPointer->getRegisterAccessor<UserType>(registerPathName, 1, wordOffsetInRegister, flags));
+    auto accessor =
+        _deviceBackendPointer->getRegisterAccessor<UserType>(registerPathName, 1, wordOffsetInRegister, flags);
+    return ScalarRegisterAccessor<UserType>(attachTransferStatistics(accessor));
   }
 
   /********************************************************************************************************************/
@@ -273,8 +299,9 @@ namespace ChimeraTK {
   OneDRegisterAccessor<UserType> Device::getOneDRegisterAccessor(const RegisterPath& registerPathName,
       size_t numberOfWords, size_t wordOffsetInRegister, const AccessModeFlags& flags) const {
     checkPointersAreNotNull();
-    return OneDRegisterAccessor<UserType>(_deviceBackendPointer->getRegisterAccessor<UserType>(
-        registerPathName, numberOfWords, wordOffsetInRegister, flags));
+    auto accessor = _deviceBackendPointer->getRegisterAccessor<UserType>(
+        registerPathName, numberOfWords, wordOffsetInRegister, flags);
+    return OneDRegisterAccessor<UserType>(attachTransferStatistics(accessor));
   }
 
   /********************************************************************************************************************/
@@ -283,8 +310,21 @@ namespace ChimeraTK {
   TwoDRegisterAccessor<UserType> Device::getTwoDRegisterAccessor(const RegisterPath& registerPathName,
       size_t numberOfElements, size_t elementsOffset, const AccessModeFlags& flags) const {
     checkPointersAreNotNull();
-    return TwoDRegisterAccessor<UserType>(_deviceBackendPointer->getRegisterAccessor<UserType>(
-        registerPathName, numberOfElements, elementsOffset, flags));
+    auto accessor = _deviceBackendPointer->getRegisterAccessor<UserType>(
+        registerPathName, numberOfElements, elementsOffset, flags);
+    return TwoDRegisterAccessor<UserType>(attachTransferStatistics(accessor));
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType>
+  boost::shared_ptr<NDRegisterAccessor<UserType>> Device::attachTransferStatistics(
+      const boost::shared_ptr<NDRegisterAccessor<UserType>>& accessor) const {
+    auto backend = boost::dynamic_pointer_cast<DeviceBackendImpl>(_deviceBackendPointer);
+    if(backend) {
+      backend->attachTransferStatistics(accessor);
+    }
+    return accessor;
   }
 
   /********************************************************************************************************************/
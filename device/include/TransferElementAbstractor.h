@@ -191,6 +191,14 @@ namespace ChimeraTK {
      */
     [[nodiscard]] TransferElementID getId() const { return _impl->getId(); }
 
+    /**
+     * Return the statistics of the transfers of this accessor, or a nullptr if the accessor has been obtained before
+     * Device::enableTransferStatistics() was called.
+     */
+    [[nodiscard]] boost::shared_ptr<const TransferStatistics> getTransferStatistics() const {
+      return _impl->getTransferStatistics();
+    }
+
     /**
      * Set the current DataValidity for this TransferElement. Will do nothing if the backend does not support it
      */
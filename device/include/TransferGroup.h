@@ -4,7 +4,12 @@
 
 #include "TransferElementAbstractor.h"
 
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <set>
+#include <type_traits>
+#include <vector>
 
 namespace ChimeraTK {
 
@@ -28,14 +33,36 @@ namespace ChimeraTK {
     /**
      * Add a register accessor to the group. The register accessor might internally be altered so that accessors
      * accessing the same hardware register will share their buffers. Register accessors must not be placed into
-     * multiple TransferGroups.
+     * multiple TransferGroups. Accessors with AccessMode::wait_for_new_data or AccessMode::zero_copy cannot be added,
+     * a ChimeraTK::logic_error is thrown in this case.
      */
     void addAccessor(TransferElementAbstractor& accessor);
 
     /** See the other signature of addAccessor() */
     void addAccessor(const boost::shared_ptr<TransferElement>& accessor);
 
-    /** Trigger read transfer for all accessors in the group */
+    /**
+     * Add multiple register accessors to the group at once. The range may contain either TransferElementAbstractors
+     * (e.g. ScalarRegisterAccessors, OneDRegisterAccessors etc.) or boost::shared_ptr<TransferElement>. The range
+     * must be given as a non-const reference, since the abstractors might be altered (see addAccessor()).
+     *
+     * The result is equivalent to adding the accessors one by one with addAccessor(), but the group is built in a
+     * single pass: all elements are sorted by type and TransferElement::getReplacementKey(), and replacement
+     * candidates are only offered to elements of the same type and name at the same or the following position. This
+     * makes the construction of groups with thousands of accessors scale close to linearly, while addAccessor()
+     * scales with the third power of the number of accessors.
+     *
+     * If any of the accessors cannot be added (see addAccessor()), a ChimeraTK::logic_error is thrown and none of the
+     * accessors is added.
+     */
+    template<typename ACCESSOR_RANGE>
+    void addAccessors(ACCESSOR_RANGE& accessors);
+
+    /**
+     * Trigger read transfer for all accessors in the group. The low-level reads of each backend are passed to the
+     * backend at once where supported (see TransferElement::createReadBatch() and
+     * NumericAddressedBackend::readMultiple()), so it can execute them concurrently.
+     */
     void read();
 
     /** Trigger write transfer for all accessors in the group */
@@ -63,6 +90,23 @@ namespace ChimeraTK {
      */
     void dump();
 
+    /**
+     * Enable or disable parallel execution of the low-level transfers. If enabled, the low-level transfers of
+     * different backends are executed concurrently on the shared ThreadPool, while the transfers of a single backend
+     * are still executed sequentially in the same order as without parallel execution. The calling thread waits until
+     * all transfers have completed before the postRead()/postWrite() phase is executed.
+     *
+     * This mode only pays off if the group contains accessors of several independent backends with noticeable transfer
+     * latency each. It is disabled by default.
+     *
+     * Note: The transfers are not executed in the calling thread, hence boost::thread::interrupt() on the calling
+     * thread will not interrupt them.
+     */
+    void setParallelTransfers(bool enable) { _parallelTransfers = enable; }
+
+    /** Check whether parallel execution of the low-level transfers is enabled, see setParallelTransfers(). */
+    [[nodiscard]] bool hasParallelTransfers() const { return _parallelTransfers; }
+
    protected:
     /**
      * List of low-level TransferElements in this group, which are directly responsible for the hardware access, and a
@@ -70,6 +114,35 @@ namespace ChimeraTK {
      */
     std::map<boost::shared_ptr<TransferElement>, bool /*hasSeenException*/> _lowLevelElementsAndExceptionFlags;
 
+    /** The low-level TransferElements of one exception backend, see _lowLevelElementsByBackend. */
+    struct LowLevelElementsOfBackend {
+      /** All elements, in the same order as in _lowLevelElementsAndExceptionFlags */
+      std::vector<boost::shared_ptr<TransferElement>> elements;
+
+      /** The elements which are read one by one, since they are not part of any of the readBatches */
+      std::vector<boost::shared_ptr<TransferElement>> individualReads;
+
+      /** Batches of elements which are read together (see TransferElement::createReadBatch()), each with at least two
+       * elements */
+      std::vector<std::shared_ptr<TransferElement::ReadBatch>> readBatches;
+
+      /**
+       * Durations of the last read transfers: one entry per element of individualReads, followed by one entry per
+       * readBatches. Only filled if the group records TransferStatistics, otherwise empty.
+       */
+      std::vector<std::chrono::nanoseconds> readDurations;
+
+      /** Durations of the last write transfers, one entry per element. Only filled like readDurations. */
+      std::vector<std::chrono::nanoseconds> writeDurations;
+    };
+
+    /**
+     * The low-level TransferElements grouped by their exception backend. Used for the parallel execution of transfers
+     * (see setParallelTransfers()). This is built in updateElementLists(), so no allocations are needed for the
+     * transfers.
+     */
+    std::vector<LowLevelElementsOfBackend> _lowLevelElementsByBackend;
+
     /**
      * List of all CopyRegisterDecorators in the group. On these elements, postRead() has to be executed before all
      * other elements.
@@ -79,6 +152,24 @@ namespace ChimeraTK {
     /** List of high-level TransferElements in this group which are directly used by the user */
     std::set<boost::shared_ptr<TransferElement>> _highLevelElements;
 
+    /**
+     * A high-level TransferElement with TransferStatistics attached, together with the transfers of its low-level
+     * elements. Each transfer is given as index into _lowLevelElementsByBackend and index into the readDurations resp.
+     * writeDurations of that entry.
+     */
+    struct HighLevelElementWithStatistics {
+      boost::shared_ptr<TransferElement> element;
+      std::vector<std::pair<size_t, size_t>> reads;
+      std::vector<std::pair<size_t, size_t>> writes;
+    };
+
+    /**
+     * The high-level TransferElements which have TransferStatistics attached. The transfers of the group are recorded
+     * in their statistics, since the group does not call their transfer functions. The latency recorded for an element
+     * is the sum of the durations of the transfers of its own low-level elements.
+     */
+    std::vector<HighLevelElementWithStatistics> _highLevelElementsWithStatistics;
+
     /**
      * List of all exception backends. We check on them whether they are opened, and we want to do it for all accessors
      * of the same backend just once.
@@ -104,8 +195,57 @@ namespace ChimeraTK {
     // Counter how many runtime errors have been thrown.
     size_t _nRuntimeErrors;
 
+    /** Flag whether low-level transfers of different backends are executed concurrently */
+    bool _parallelTransfers{false};
+
+    /** Storage for the tasks of the parallel execution in runLowLevelTransfers(), kept to avoid allocations */
+    std::vector<std::function<void()>> _parallelTasks;
+
+    // Execute the given transfer function on the low-level elements of each backend (either sequentially or in
+    // parallel, see setParallelTransfers()) and return the first runtime error seen, in the order of
+    // _lowLevelElementsAndExceptionFlags.
+    std::exception_ptr runLowLevelTransfers(
+        const std::function<void(LowLevelElementsOfBackend&)>& transferElementsOfBackend);
+
+    // Read the low-level elements of one backend. The reads of elements in the same ReadBatch are executed together, so
+    // the backend can have them in flight at the same time.
+    static void readTransfersOfBackend(LowLevelElementsOfBackend& elementsOfBackend);
+
+    // Record a successful transfer of the group in the statistics of the high-level elements
+    void recordTransferStatistics(bool isRead);
+
    private:
     void addAccessorImpl(TransferElementAbstractor& accessor, bool isTemporaryAbstractor);
+
+    void addAccessorsImpl(const std::vector<TransferElementAbstractor*>& accessors,
+        const std::vector<boost::shared_ptr<TransferElement>>& elements);
+
+    // Throw a logic_error if the given accessor cannot be added to the group
+    static void checkAccessorCanBeAdded(TransferElementAbstractor& accessor);
+
+    // Replace or merge the internal elements of all high-level elements in a single sweep over all elements sorted by
+    // TransferElement::getReplacementKey()
+    void replaceInternalElements();
+
+    // Update the lists of low-level elements and copy decorators from the list of high-level elements
+    void updateElementLists();
   };
 
+  /********************************************************************************************************************/
+
+  template<typename ACCESSOR_RANGE>
+  void TransferGroup::addAccessors(ACCESSOR_RANGE& accessors) {
+    std::vector<TransferElementAbstractor*> abstractors;
+    std::vector<boost::shared_ptr<TransferElement>> elements;
+    for(auto& accessor : accessors) {
+      if constexpr(std::is_base_of<TransferElementAbstractor, std::decay_t<decltype(accessor)>>::value) {
+        abstractors.push_back(&accessor);
+      }
+      else {
+        elements.push_back(accessor);
+      }
+    }
+    addAccessorsImpl(abstractors, elements);
+  }
+
 } /* namespace ChimeraTK */
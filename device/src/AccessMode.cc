@@ -97,7 +97,8 @@ namespace ChimeraTK {
 
   const std::map<AccessMode, std::string>& AccessModeFlags::getStringMap() {
     static std::map<AccessMode, std::string> m = {
-        {AccessMode::raw, "raw"}, {AccessMode::wait_for_new_data, "wait_for_new_data"}};
+        {AccessMode::raw, "raw"}, {AccessMode::wait_for_new_data, "wait_for_new_data"},
+        {AccessMode::zero_copy, "zero_copy"}};
     return m;
   }
 
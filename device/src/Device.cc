@@ -4,6 +4,7 @@
 #include "Device.h"
 
 #include "DeviceBackend.h"
+#include "DeviceBackendImpl.h"
 
 #include <cmath>
 #include <cstring>
@@ -100,10 +101,34 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  void Device::enableTransferStatistics() {
+    checkPointersAreNotNull();
+    auto backend = boost::dynamic_pointer_cast<DeviceBackendImpl>(_deviceBackendPointer);
+    if(!backend) {
+      throw ChimeraTK::logic_error(
+          "Device::enableTransferStatistics(): The backend does not support transfer statistics.");
+    }
+    backend->enableTransferStatistics();
+  }
+
+  /********************************************************************************************************************/
+
+  boost::shared_ptr<TransferStatistics> Device::getTransferStatistics() const {
+    checkPointersAreNotNull();
+    auto backend = boost::dynamic_pointer_cast<DeviceBackendImpl>(_deviceBackendPointer);
+    if(!backend) {
+      return nullptr;
+    }
+    return backend->getTransferStatistics();
+  }
+
+  /********************************************************************************************************************/
+
   VoidRegisterAccessor Device::getVoidRegisterAccessor(
       const RegisterPath& registerPathName, const AccessModeFlags& flags) const {
     checkPointersAreNotNull();
-    return {_deviceBackendPointer->getRegisterAccessor<Void>(registerPathName, 0, 0, flags)};
+    auto accessor = _deviceBackendPointer->getRegisterAccessor<Void>(registerPathName, 0, 0, flags);
+    return {attachTransferStatistics(accessor)};
   }
 
   /********************************************************************************************************************/
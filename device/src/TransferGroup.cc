@@ -5,10 +5,16 @@
 
 #include "CopyRegisterDecorator.h"
 #include "Exception.h"
+#include "ThreadPool.h"
 #include "TransferElement.h"
 #include "TransferElementAbstractor.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <map>
+#include <tuple>
+#include <typeindex>
 
 namespace ChimeraTK {
 
@@ -36,6 +42,82 @@ namespace ChimeraTK {
       catch(ChimeraTK::runtime_error&) {
         ++_nRuntimeErrors;
       }
+      catch(boost::thread_interrupted&) {
+        // An interruption of the transfer phase (see readTransfersOfBackend()) is re-thrown like a runtime error, after
+        // all elements have seen it.
+        ++_nRuntimeErrors;
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  std::exception_ptr TransferGroup::runLowLevelTransfers(
+      const std::function<void(LowLevelElementsOfBackend&)>& transferElementsOfBackend) {
+    if(_parallelTransfers && _lowLevelElementsByBackend.size() > 1) {
+      // Each task handles all elements of one backend. Exceptions from the transfers are caught
+      // inside handleTransferException() (or the ReadBatch) and stored in the elements, so the tasks themselves never
+      // throw.
+      // The storage of the task list is reused, it has been reserved in updateElementLists().
+      _parallelTasks.clear();
+      for(auto& elementsOfBackend : _lowLevelElementsByBackend) {
+        _parallelTasks.emplace_back([&] { transferElementsOfBackend(elementsOfBackend); });
+      }
+      ThreadPool::shared().runAll(_parallelTasks);
+    }
+    else {
+      for(auto& elementsOfBackend : _lowLevelElementsByBackend) {
+        transferElementsOfBackend(elementsOfBackend);
+      }
+    }
+
+    // Determine the first exception in the same order as for the sequential execution, so the result does not depend
+    // on the timing of the concurrent transfers.
+    for(const auto& it : _lowLevelElementsAndExceptionFlags) {
+      if(it.first->_activeException != nullptr) {
+        return it.first->_activeException;
+      }
+    }
+    return nullptr;
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferGroup::readTransfersOfBackend(LowLevelElementsOfBackend& elementsOfBackend) {
+    // The durations are measured only if needed for the TransferStatistics, see recordTransferStatistics().
+    auto& durations = elementsOfBackend.readDurations;
+    bool measure = !durations.empty();
+    std::chrono::steady_clock::time_point start;
+    size_t i = 0;
+    for(const auto& elem : elementsOfBackend.individualReads) {
+      if(measure) start = std::chrono::steady_clock::now();
+      elem->handleTransferException([&] { elem->readTransfer(); });
+      if(measure) durations[i++] = std::chrono::steady_clock::now() - start;
+    }
+    for(const auto& batch : elementsOfBackend.readBatches) {
+      if(measure) start = std::chrono::steady_clock::now();
+      batch->readTransfer();
+      if(measure) durations[i++] = std::chrono::steady_clock::now() - start;
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferGroup::recordTransferStatistics(bool isRead) {
+    for(const auto& elem : _highLevelElementsWithStatistics) {
+      std::chrono::nanoseconds latency{0};
+      if(isRead) {
+        for(const auto& [backendIndex, i] : elem.reads) {
+          latency += _lowLevelElementsByBackend[backendIndex].readDurations[i];
+        }
+        elem.element->_transferStatistics->recordRead(latency);
+      }
+      else {
+        for(const auto& [backendIndex, i] : elem.writes) {
+          latency += _lowLevelElementsByBackend[backendIndex].writeDurations[i];
+        }
+        elem.element->_transferStatistics->recordWrite(latency);
+      }
     }
   }
 
@@ -75,12 +157,9 @@ namespace ChimeraTK {
 
     if(firstDetectedRuntimeError == nullptr) {
       // only execute the transfers if there has been no exception yet
-      for(const auto& it : _lowLevelElementsAndExceptionFlags) {
-        const auto& elem = it.first;
-        elem->handleTransferException([&] { elem->readTransfer(); });
-        if((elem->_activeException != nullptr) && (firstDetectedRuntimeError == nullptr)) {
-          firstDetectedRuntimeError = elem->_activeException;
-        }
+      firstDetectedRuntimeError = runLowLevelTransfers(readTransfersOfBackend);
+      if(firstDetectedRuntimeError == nullptr) {
+        recordTransferStatistics(true);
       }
     }
 
@@ -144,12 +223,20 @@ namespace ChimeraTK {
     }
 
     if(firstDetectedRuntimeError == nullptr) {
-      for(const auto& it : _lowLevelElementsAndExceptionFlags) {
-        const auto& elem = it.first;
-        elem->handleTransferException([&] { elem->writeTransfer(versionNumber); });
-        if((elem->_activeException != nullptr) && (firstDetectedRuntimeError == nullptr)) {
-          firstDetectedRuntimeError = elem->_activeException;
+      firstDetectedRuntimeError = runLowLevelTransfers([&](LowLevelElementsOfBackend& elementsOfBackend) {
+        // see readTransfersOfBackend() for the durations
+        auto& durations = elementsOfBackend.writeDurations;
+        bool measure = !durations.empty();
+        std::chrono::steady_clock::time_point start;
+        for(size_t i = 0; i < elementsOfBackend.elements.size(); ++i) {
+          const auto& elem = elementsOfBackend.elements[i];
+          if(measure) start = std::chrono::steady_clock::now();
+          elem->handleTransferException([&] { elem->writeTransfer(versionNumber); });
+          if(measure) durations[i] = std::chrono::steady_clock::now() - start;
         }
+      });
+      if(firstDetectedRuntimeError == nullptr) {
+        recordTransferStatistics(false);
       }
     }
 
@@ -207,7 +294,7 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  void TransferGroup::addAccessorImpl(TransferElementAbstractor& accessor, bool isTemporary) {
+  void TransferGroup::checkAccessorCanBeAdded(TransferElementAbstractor& accessor) {
     // check if accessor is already in a transfer group
     if(accessor.getHighLevelImplElement()->_isInTransferGroup) {
       throw ChimeraTK::logic_error("The given accessor is already in a TransferGroup and cannot be added "
@@ -220,6 +307,19 @@ namespace ChimeraTK {
           "A TransferGroup can only be used with transfer elements that don't have aAccessMode::wait_for_new_data.");
     }
 
+    // Zero-copy accessors would receive data into their user buffer even if another element of the group fails, which
+    // breaks the exception guarantee of the group.
+    if(accessor.getAccessModeFlags().has(AccessMode::zero_copy)) {
+      throw ChimeraTK::logic_error(
+          "A TransferGroup cannot be used with transfer elements that have AccessMode::zero_copy.");
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferGroup::addAccessorImpl(TransferElementAbstractor& accessor, bool isTemporary) {
+    checkAccessorCanBeAdded(accessor);
+
     // set flag on the accessors that it is now in a transfer group
     accessor.getHighLevelImplElement()->_isInTransferGroup = true;
 
@@ -250,6 +350,12 @@ namespace ChimeraTK {
     // replacement process
     _highLevelElements.insert(accessor.getHighLevelImplElement());
 
+    updateElementLists();
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferGroup::updateElementLists() {
     // update the list of hardware-accessing elements, since we might just have
     // made some of them redundant since we are using a set to store the elements,
     // duplicates are intrinsically avoided.
@@ -260,6 +366,106 @@ namespace ChimeraTK {
       }
     }
 
+    // group the hardware-accessing elements by backend for the parallel execution of transfers
+    _lowLevelElementsByBackend.clear();
+    std::map<boost::shared_ptr<DeviceBackend>, size_t> backendIndices;
+    for(const auto& it : _lowLevelElementsAndExceptionFlags) {
+      auto [indexIt, isNew] =
+          backendIndices.try_emplace(it.first->getExceptionBackend(), _lowLevelElementsByBackend.size());
+      if(isNew) _lowLevelElementsByBackend.emplace_back();
+      _lowLevelElementsByBackend[indexIt->second].elements.push_back(it.first);
+    }
+
+    _parallelTasks.clear();
+    _parallelTasks.reserve(_lowLevelElementsByBackend.size());
+
+    // combine the reads of each backend into batches where possible
+    // Remember where the transfers of each element end up, for the TransferStatistics of the high-level elements:
+    // index into _lowLevelElementsByBackend, index into readDurations and index into writeDurations of that entry.
+    std::map<boost::shared_ptr<TransferElement>, std::tuple<size_t, size_t, size_t>> transfersOfElement;
+    for(size_t backendIndex = 0; backendIndex < _lowLevelElementsByBackend.size(); ++backendIndex) {
+      auto& elementsOfBackend = _lowLevelElementsByBackend[backendIndex];
+      // batches together with the element which has created them
+      std::vector<std::pair<boost::shared_ptr<TransferElement>, std::unique_ptr<TransferElement::ReadBatch>>> batches;
+      // index into batches for the elements which have been added to a batch
+      std::map<boost::shared_ptr<TransferElement>, size_t> batchOfElement;
+      for(const auto& elem : elementsOfBackend.elements) {
+        auto batchIt =
+            std::find_if(batches.begin(), batches.end(), [&](const auto& batch) { return batch.second->add(elem); });
+        if(batchIt != batches.end()) {
+          batchOfElement[elem] = batchIt - batches.begin();
+          continue;
+        }
+        auto batch = elem->createReadBatch();
+        if(batch) {
+          batchOfElement[elem] = batches.size();
+          batches.emplace_back(elem, std::move(batch));
+        }
+        else {
+          elementsOfBackend.individualReads.push_back(elem);
+        }
+      }
+      // A batch with a single element has no advantage over reading the element directly, so it is dissolved.
+      std::vector<size_t> readBatchIndices(batches.size());
+      for(size_t i = 0; i < batches.size(); ++i) {
+        auto& [creator, batch] = batches[i];
+        if(batch->size() == 1) {
+          batchOfElement.erase(creator);
+          elementsOfBackend.individualReads.push_back(creator);
+        }
+        else {
+          readBatchIndices[i] = elementsOfBackend.readBatches.size();
+          elementsOfBackend.readBatches.push_back(std::move(batch));
+        }
+      }
+
+      const auto& individualReads = elementsOfBackend.individualReads;
+      for(size_t i = 0; i < individualReads.size(); ++i) {
+        std::get<1>(transfersOfElement[individualReads[i]]) = i;
+      }
+      for(const auto& [elem, batchIndex] : batchOfElement) {
+        std::get<1>(transfersOfElement[elem]) = individualReads.size() + readBatchIndices[batchIndex];
+      }
+      for(size_t i = 0; i < elementsOfBackend.elements.size(); ++i) {
+        auto& transfers = transfersOfElement[elementsOfBackend.elements[i]];
+        std::get<0>(transfers) = backendIndex;
+        std::get<2>(transfers) = i;
+      }
+    }
+
+    // update the list of high-level elements with statistics
+    _highLevelElementsWithStatistics.clear();
+    for(const auto& hlElem : _highLevelElements) {
+      if(!hlElem->_transferStatistics) {
+        continue;
+      }
+      auto lowLevelElements = hlElem->getHardwareAccessingElements();
+      if(std::find(lowLevelElements.begin(), lowLevelElements.end(), hlElem) != lowLevelElements.end()) {
+        // the element records its own transfers
+        continue;
+      }
+      HighLevelElementWithStatistics elemWithStatistics{hlElem, {}, {}};
+      for(const auto& llElem : lowLevelElements) {
+        auto [backendIndex, readIndex, writeIndex] = transfersOfElement.at(llElem);
+        elemWithStatistics.reads.emplace_back(backendIndex, readIndex);
+        elemWithStatistics.writes.emplace_back(backendIndex, writeIndex);
+      }
+      // several low-level elements may be read in the same batch, which counts only once
+      auto& reads = elemWithStatistics.reads;
+      std::sort(reads.begin(), reads.end());
+      reads.erase(std::unique(reads.begin(), reads.end()), reads.end());
+      _highLevelElementsWithStatistics.push_back(std::move(elemWithStatistics));
+    }
+
+    // the durations of the transfers are only measured if needed
+    if(!_highLevelElementsWithStatistics.empty()) {
+      for(auto& elementsOfBackend : _lowLevelElementsByBackend) {
+        elementsOfBackend.readDurations.resize(
+            elementsOfBackend.individualReads.size() + elementsOfBackend.readBatches.size());
+        elementsOfBackend.writeDurations.resize(elementsOfBackend.elements.size());
+      }
+    }
+
     // update the list of CopyRegisterDecorators
     _copyDecorators.clear();
     for(const auto& hlElem : _highLevelElements) {
@@ -308,6 +514,162 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  namespace {
+    /// Key to find the elements which might replace each other: the type, the name and the position returned by
+    /// TransferElement::getReplacementKey().
+    using ReplacementKey = std::tuple<std::type_index, std::string, uint64_t>;
+
+    ReplacementKey getReplacementKey(const boost::shared_ptr<TransferElement>& element) {
+      auto [name, position] = element->getReplacementKey();
+      return {std::type_index(typeid(*element)), std::move(name), position};
+    }
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  void TransferGroup::addAccessorsImpl(const std::vector<TransferElementAbstractor*>& accessors,
+      const std::vector<boost::shared_ptr<TransferElement>>& elements) {
+    // Create temporary abstractors for the plain TransferElements. Replacements on the abstractor level are only done
+    // for the abstractors passed by the caller.
+    std::vector<detail::TransferGroupTransferElementAbstractor> temporaries;
+    temporaries.reserve(elements.size());
+    for(const auto& element : elements) {
+      temporaries.emplace_back(element);
+    }
+
+    std::vector<std::pair<TransferElementAbstractor*, bool /*isTemporary*/>> newAccessors;
+    newAccessors.reserve(accessors.size() + temporaries.size());
+    for(auto* accessor : accessors) {
+      newAccessors.emplace_back(accessor, false);
+    }
+    for(auto& temporary : temporaries) {
+      newAccessors.emplace_back(&temporary, true);
+    }
+
+    // check all accessors before altering anything, so the group stays unchanged in case of an error
+    std::set<boost::shared_ptr<TransferElement>> newHighLevelElements;
+    for(auto& accessor : newAccessors) {
+      checkAccessorCanBeAdded(*accessor.first);
+      if(!newHighLevelElements.insert(accessor.first->getHighLevelImplElement()).second) {
+        throw ChimeraTK::logic_error("The accessor '" + accessor.first->getName() +
+            "' is passed multiple times to TransferGroup::addAccessors().");
+      }
+    }
+
+    // Index of all replacement candidates (high-level elements and their internal elements) by their key
+    std::map<ReplacementKey, std::vector<boost::shared_ptr<TransferElement>>> candidatesByKey;
+    std::set<boost::shared_ptr<TransferElement>> knownCandidates;
+    auto addCandidates = [&](const boost::shared_ptr<TransferElement>& hlElem) {
+      auto list = hlElem->getInternalElements();
+      list.push_front(hlElem);
+      for(const auto& element : list) {
+        if(knownCandidates.insert(element).second) {
+          candidatesByKey[getReplacementKey(element)].push_back(element);
+        }
+      }
+    };
+    for(const auto& hlElem : _highLevelElements) {
+      addCandidates(hlElem);
+    }
+
+    // Replacement on the abstractor level: this must be done one by one in the same way as in addAccessorImpl(), so an
+    // accessor is only replaced by accessors which are already part of the group. Only identical elements can be
+    // replaced on this level (see TransferElement::mayReplaceOther()), so only candidates with the same key are tried.
+    for(auto& [accessor, isTemporary] : newAccessors) {
+      accessor->getHighLevelImplElement()->_isInTransferGroup = true;
+      _exceptionBackends.insert(accessor->getHighLevelImplElement()->getExceptionBackend());
+      if(!isTemporary) {
+        auto it = candidatesByKey.find(getReplacementKey(accessor->getHighLevelImplElement()));
+        if(it != candidatesByKey.end()) {
+          for(const auto& replacement : it->second) {
+            accessor->replaceTransferElement(replacement);
+          }
+        }
+      }
+      addCandidates(accessor->getHighLevelImplElement());
+    }
+
+    // The high-level elements may have been replaced in the previous step, so this must be done only now.
+    for(auto& accessor : newAccessors) {
+      _highLevelElements.insert(accessor.first->getHighLevelImplElement());
+    }
+
+    replaceInternalElements();
+
+    updateElementLists();
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferGroup::replaceInternalElements() {
+    // collect all elements together with the high-level elements using them internally
+    std::map<boost::shared_ptr<TransferElement>, std::vector<boost::shared_ptr<TransferElement>>> users;
+    for(const auto& hlElem : _highLevelElements) {
+      users[hlElem];
+      for(const auto& element : hlElem->getInternalElements()) {
+        auto& usersOfElement = users[element];
+        if(usersOfElement.empty() || usersOfElement.back() != hlElem) usersOfElement.push_back(hlElem);
+      }
+    }
+
+    // Sort by key. Elements without users come first among elements with the same key, so they are used as
+    // replacement for the others.
+    struct Candidate {
+      ReplacementKey key;
+      bool hasUsers;
+      boost::shared_ptr<TransferElement> element;
+    };
+    std::vector<Candidate> sorted;
+    sorted.reserve(users.size());
+    for(const auto& [element, usersOfElement] : users) {
+      sorted.push_back({getReplacementKey(element), !usersOfElement.empty(), element});
+    }
+    std::sort(sorted.begin(), sorted.end(),
+        [](const auto& a, const auto& b) { return std::tie(a.key, a.hasUsers) < std::tie(b.key, b.hasUsers); });
+
+    auto isUsedBy = [](const boost::shared_ptr<TransferElement>& user, const boost::shared_ptr<TransferElement>& elem) {
+      auto list = user->getInternalElements();
+      return std::find(list.begin(), list.end(), elem) != list.end();
+    };
+
+    // Sweep through the sorted list. The targets are the elements at the current position which have not been replaced
+    // themselves. The targets are offered to the users of each following element of the same type and name, until
+    // none of the users uses the element anymore. Targets which merge other elements (like the
+    // NumericAddressedLowLevelTransferElement) grow with each merge, so the next element is compared against the full
+    // merged range.
+    std::vector<boost::shared_ptr<TransferElement>> targets;
+    const ReplacementKey* targetKey{nullptr};
+    for(const auto& candidate : sorted) {
+      const auto& usersOfElement = users[candidate.element];
+      auto isReplaced = [&] {
+        return candidate.hasUsers && std::none_of(usersOfElement.begin(), usersOfElement.end(),
+                                         [&](const auto& user) { return isUsedBy(user, candidate.element); });
+      };
+
+      bool isSameTypeAndName = targetKey && std::get<0>(*targetKey) == std::get<0>(candidate.key) &&
+          std::get<1>(*targetKey) == std::get<1>(candidate.key);
+      if(isSameTypeAndName && candidate.hasUsers) {
+        for(const auto& target : targets) {
+          for(const auto& user : usersOfElement) {
+            if(isUsedBy(user, candidate.element)) user->replaceTransferElement(target);
+          }
+          if(isReplaced()) break;
+        }
+      }
+      // Elements which are no longer used (also if they have been replaced together with an element using them) cannot
+      // be used as a target.
+      if(isReplaced()) continue;
+
+      if(!isSameTypeAndName || std::get<2>(*targetKey) != std::get<2>(candidate.key)) {
+        targets.clear();
+        targetKey = &candidate.key;
+      }
+      targets.push_back(candidate.element);
+    }
+  }
+
+  /********************************************************************************************************************/
+
   void TransferGroup::updateIsReadableWriteable() {
     _isReadable = true;
     _isWriteable = true;
@@ -169,7 +169,9 @@ namespace ChimeraTK {
     // dmap file is relative to the dmap file location. Converting the relative
     // mapFile path to an absolute path avoids issues when the dmap file is not
     // in the working directory of the application.
-    return returnInstance<DummyBackend>(address, convertPathRelativeToDmapToAbs(parameters["map"]));
+    auto backend = returnInstance<DummyBackend>(address, convertPathRelativeToDmapToAbs(parameters["map"]));
+    boost::static_pointer_cast<DummyBackend>(backend)->applyCommonParameters(parameters);
+    return backend;
   }
 
   std::string DummyBackend::convertPathRelativeToDmapToAbs(const std::string& mapfileName) {
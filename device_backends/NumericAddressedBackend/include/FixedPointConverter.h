@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Exception.h"
+#include "SimdSupport.h"
 #include "SupportedUserTypes.h"
 #include <type_traits>
 
@@ -22,6 +23,15 @@
 
 namespace ChimeraTK {
 
+  namespace detail {
+    /// Check whether the FixedPointConverter has vectorised conversion kernels for the given raw and user types
+    template<typename RawType, typename UserType>
+    constexpr bool hasFixedPointSimdKernel =
+        (std::is_same<RawType, int16_t>::value || std::is_same<RawType, int32_t>::value) &&
+        (std::is_same<UserType, int32_t>::value || std::is_same<UserType, float>::value ||
+            std::is_same<UserType, double>::value);
+  } // namespace detail
+
   /** The fixed point converter provides conversion functions
    *  between a user type and up to 32 bit fixed point (signed or unsigned).
    */
@@ -53,6 +63,14 @@ namespace ChimeraTK {
     template<typename UserType>
     uint32_t toRaw(UserType cookedValue) const;
 
+    /**
+     *  Conversion function from type T to fixed-point values. The result is identical to calling toRaw() for each
+     *  element. The raw range must already be properly allocated with the size of the cooked range.
+     */
+    template<typename UserType, typename COOKED_ITERATOR, typename RAW_ITERATOR>
+    void vectorToRaw(
+        const COOKED_ITERATOR& cooked_begin, const COOKED_ITERATOR& cooked_end, RAW_ITERATOR raw_begin) const;
+
     /**
      *  Conversion function from fixed-point values to type T.
      *  The two vectors passed must be of equal size (i.e. cookedValues must already be properly allocated).
@@ -148,6 +166,15 @@ namespace ChimeraTK {
     /// always 0
     const static int zero;
 
+    /// Vectorised conversion kernels for contiguous buffers (see FixedPointConverterSimd.cc). They convert a prefix of
+    /// the given range and return its length, which is 0 if the CPU or the configuration is not supported. The
+    /// remaining elements must be converted by the generic implementation, which gives bit-identical results.
+    template<typename RawType, typename UserType>
+    size_t vectorToCookedSimd(const RawType* raw, size_t n, UserType* cooked) const;
+
+    template<typename UserType, typename RawType>
+    size_t vectorToRawSimd(const UserType* cooked, size_t n, RawType* raw) const;
+
     /// helper class to initialise coefficients etc. for all possible UserTypes
     class initCoefficients {
      public:
@@ -249,65 +276,78 @@ namespace ChimeraTK {
   void FixedPointConverter::vectorToCooked_impl<UserType, RAW_ITERATOR, COOKED_ITERATOR>::impl(
       const FixedPointConverter& fpc, const RAW_ITERATOR& raw_begin, const RAW_ITERATOR& raw_end,
       COOKED_ITERATOR cooked_begin) {
+    auto raw_it = raw_begin;
+
+    // Use the vectorised kernels for the common cases. They may leave a remainder for the generic implementation.
+    using RawType = typename std::iterator_traits<RAW_ITERATOR>::value_type;
+    if constexpr(detail::hasFixedPointSimdKernel<RawType, UserType> && detail::isContiguousIterator<RAW_ITERATOR> &&
+        detail::isContiguousIterator<COOKED_ITERATOR>) {
+      if(raw_begin != raw_end) {
+        auto nConverted = fpc.vectorToCookedSimd(&(*raw_begin), raw_end - raw_begin, &(*cooked_begin));
+        raw_it += nConverted;
+        cooked_begin += nConverted;
+      }
+    }
+
     // Handle integer and floating-point types differently.
     switch(boost::fusion::at_key<UserType>(fpc.conversionBranch_toCooked.table)) {
       case 1: { // std::numeric_limits<UserType>::is_integer && _fpc->_fractionalBits == 0 && !_fpc->_isSigned
-        std::transform(raw_begin, raw_end, cooked_begin, [&fpc](int32_t rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [&fpc](int32_t rawValue) {
           fpc.padUnusedBits(rawValue);
           return numericToUserType<UserType>(*(reinterpret_cast<uint32_t*>(&rawValue)));
         });
         break;
       }
       case 2: { // std::numeric_limits<UserType>::is_integer && _fpc->_fractionalBits == 0 && _fpc->_isSigned
-        std::transform(raw_begin, raw_end, cooked_begin, [&fpc](int32_t rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [&fpc](int32_t rawValue) {
           fpc.padUnusedBits(rawValue);
           return numericToUserType<UserType>(rawValue);
         });
         break;
       }
       case 9: { // _fpc->_nBits == 16 && _fpc->_fractionalBits == 0 && !_fpc->_isSigned
-        std::transform(raw_begin, raw_end, cooked_begin, [](const auto& rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [](const auto& rawValue) {
           return numericToUserType<UserType>(*(reinterpret_cast<const uint16_t*>(&rawValue)));
         });
         break;
       }
       case 10: { //  _fpc->_nBits == 16 && _fpc->_fractionalBits == 0 && _fpc->_isSigned
-        std::transform(raw_begin, raw_end, cooked_begin, [](const auto& rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [](const auto& rawValue) {
           return numericToUserType<UserType>(*(reinterpret_cast<const int16_t*>(&rawValue)));
         });
         break;
       }
       case 7: { // _fpc->_nBits == 16 && _fpc->_fractionalBits < 0  && _fpc->_fractionalBits > -16 && !_fpc->_isSigned
         const auto f = static_cast<uint32_t>(fpc._fractionalBitsCoefficient);
-        std::transform(raw_begin, raw_end, cooked_begin, [f](const auto& rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [f](const auto& rawValue) {
           return numericToUserType<UserType>(f * *(reinterpret_cast<const uint16_t*>(&rawValue)));
         });
         break;
       }
       case 8: { //  _fpc->_nBits == 16 && _fpc->_fractionalBits < 0 && _fpc->_fractionalBits > -16 && _fpc->_isSigned
         const auto f = static_cast<int32_t>(fpc._fractionalBitsCoefficient);
-        std::transform(raw_begin, raw_end, cooked_begin, [f](const auto& rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [f](const auto& rawValue) {
           return numericToUserType<UserType>(f * *(reinterpret_cast<const int16_t*>(&rawValue)));
         });
         break;
       }
       case 5: { // _fpc->_nBits == 16 && !_fpc->_isSigned
         const auto f = fpc._fractionalBitsCoefficient;
-        std::transform(raw_begin, raw_end, cooked_begin, [f](const auto& rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [f](const auto& rawValue) {
           return numericToUserType<UserType>(f * *(reinterpret_cast<const uint16_t*>(&rawValue)));
         });
         break;
       }
       case 6: { //  _fpc->_nBits == 16 && _fpc->_isSigned
         const auto f = fpc._fractionalBitsCoefficient;
-        std::transform(raw_begin, raw_end, cooked_begin, [f](const auto& rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [f](const auto& rawValue) {
           return numericToUserType<UserType>(f * *(reinterpret_cast<const int16_t*>(&rawValue)));
         });
         break;
       }
       case 3: { // !_fpc->_isSigned
         const auto f = fpc._fractionalBitsCoefficient;
-        std::transform(raw_begin, raw_end, cooked_begin, [&fpc, f](int32_t rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [&fpc, f](int32_t rawValue) {
           fpc.padUnusedBits(rawValue);
           return numericToUserType<UserType>(f * *(reinterpret_cast<uint32_t*>(&rawValue)));
         });
@@ -315,7 +355,7 @@ namespace ChimeraTK {
       }
       case 4: { // _fpc->_isSigned
         const auto f = fpc._fractionalBitsCoefficient;
-        std::transform(raw_begin, raw_end, cooked_begin, [&fpc, f](int32_t rawValue) {
+        std::transform(raw_it, raw_end, cooked_begin, [&fpc, f](int32_t rawValue) {
           fpc.padUnusedBits(rawValue);
           auto ttt = numericToUserType<UserType>(f * rawValue);
           return ttt;
@@ -398,6 +438,31 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  template<typename UserType, typename COOKED_ITERATOR, typename RAW_ITERATOR>
+  void FixedPointConverter::vectorToRaw(
+      const COOKED_ITERATOR& cooked_begin, const COOKED_ITERATOR& cooked_end, RAW_ITERATOR raw_begin) const {
+    static_assert(std::is_same<typename std::iterator_traits<COOKED_ITERATOR>::value_type, UserType>::value,
+        "COOKED_ITERATOR template argument must be an iterator with value type equal to the UserType template "
+        "argument.");
+    auto cooked_it = cooked_begin;
+
+    using RawType = typename std::iterator_traits<RAW_ITERATOR>::value_type;
+    if constexpr(detail::hasFixedPointSimdKernel<RawType, UserType> && detail::isContiguousIterator<RAW_ITERATOR> &&
+        detail::isContiguousIterator<COOKED_ITERATOR>) {
+      if(cooked_begin != cooked_end) {
+        auto nConverted = vectorToRawSimd(&(*cooked_begin), cooked_end - cooked_begin, &(*raw_begin));
+        cooked_it += nConverted;
+        raw_begin += nConverted;
+      }
+    }
+
+    for(; cooked_it != cooked_end; ++cooked_it, ++raw_begin) {
+      *raw_begin = toRaw<UserType>(*cooked_it);
+    }
+  }
+
+  /********************************************************************************************************************/
+
   template<typename UserType, typename std::enable_if<std::is_signed<UserType>{}, int>::type>
   bool FixedPointConverter::isNegativeUserType(UserType value) const {
     return static_cast<bool>(value < 0);
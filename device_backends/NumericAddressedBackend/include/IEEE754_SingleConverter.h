@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "SimdSupport.h"
 #include "SupportedUserTypes.h"
 
 #include <boost/numeric/conversion/cast.hpp>
@@ -75,17 +76,56 @@ namespace ChimeraTK {
     template<typename CookedType>
     uint32_t toRaw(CookedType cookedValue) const;
 
+    /** Convert a range of cooked values to raw, see FixedPointConverter::vectorToRaw() */
+    template<typename CookedType, typename COOKED_ITERATOR, typename RAW_ITERATOR>
+    void vectorToRaw(
+        const COOKED_ITERATOR& cooked_begin, const COOKED_ITERATOR& cooked_end, RAW_ITERATOR raw_begin) const;
+
     explicit IEEE754_SingleConverter(const std::string& = "") {}
 
     // all IEEE754_SingleConverters are the same
     bool operator!=(const IEEE754_SingleConverter& /*other*/) const { return false; }
     bool operator==(const IEEE754_SingleConverter& /*other*/) const { return true; }
+
+    /// Vectorised conversion kernels for contiguous buffers (see IEEE754_SingleConverterSimd.cc). They convert a
+    /// prefix of the given range and return its length, which is 0 if the CPU is not supported. The remaining elements
+    /// must be converted by the generic implementation, which gives bit-identical results.
+    template<typename CookedType>
+    static size_t vectorToCookedSimd(const int32_t* raw, size_t n, CookedType* cooked);
+
+    template<typename CookedType>
+    static size_t vectorToRawSimd(const CookedType* cooked, size_t n, int32_t* raw);
   };
 
+  namespace detail {
+    /// Check whether the IEEE754_SingleConverter has a bulk conversion path for the given raw and cooked types
+    template<typename RawType, typename CookedType>
+    constexpr bool hasIEEE754BulkConversion = std::is_same<RawType, int32_t>::value &&
+        (std::is_same<CookedType, float>::value || std::is_same<CookedType, double>::value ||
+            std::is_same<CookedType, int32_t>::value);
+  } // namespace detail
+
   template<typename CookedType, typename RAW_ITERATOR, typename COOKED_ITERATOR>
   void IEEE754_SingleConverter::vectorToCooked_impl<CookedType, RAW_ITERATOR, COOKED_ITERATOR>::impl(
       const RAW_ITERATOR& raw_begin, const RAW_ITERATOR& raw_end, COOKED_ITERATOR cooked_begin) {
-    for(auto it = raw_begin; it != raw_end; ++it) {
+    auto raw_it = raw_begin;
+
+    // Bulk conversion for contiguous buffers: floats are just copied, the other types use the vectorised kernels.
+    using RawType = typename std::iterator_traits<RAW_ITERATOR>::value_type;
+    if constexpr(detail::hasIEEE754BulkConversion<RawType, CookedType> && detail::isContiguousIterator<RAW_ITERATOR> &&
+        detail::isContiguousIterator<COOKED_ITERATOR>) {
+      if(raw_begin != raw_end) {
+        if constexpr(std::is_same<CookedType, float>::value) {
+          memcpy(&(*cooked_begin), &(*raw_begin), (raw_end - raw_begin) * sizeof(float));
+          return;
+        }
+        auto nConverted = vectorToCookedSimd(&(*raw_begin), raw_end - raw_begin, &(*cooked_begin));
+        raw_it += nConverted;
+        cooked_begin += nConverted;
+      }
+    }
+
+    for(auto it = raw_it; it != raw_end; ++it) {
       // Step 1: convert the raw data to the "generic" representation in the CPU: float
       float genericRepresentation;
       memcpy(&genericRepresentation, &(*it), sizeof(float));
@@ -119,6 +159,30 @@ namespace ChimeraTK {
     return rawValue;
   }
 
+  template<typename CookedType, typename COOKED_ITERATOR, typename RAW_ITERATOR>
+  void IEEE754_SingleConverter::vectorToRaw(
+      const COOKED_ITERATOR& cooked_begin, const COOKED_ITERATOR& cooked_end, RAW_ITERATOR raw_begin) const {
+    auto cooked_it = cooked_begin;
+
+    using RawType = typename std::iterator_traits<RAW_ITERATOR>::value_type;
+    if constexpr(detail::hasIEEE754BulkConversion<RawType, CookedType> && detail::isContiguousIterator<RAW_ITERATOR> &&
+        detail::isContiguousIterator<COOKED_ITERATOR>) {
+      if(cooked_begin != cooked_end) {
+        if constexpr(std::is_same<CookedType, float>::value) {
+          memcpy(&(*raw_begin), &(*cooked_begin), (cooked_end - cooked_begin) * sizeof(float));
+          return;
+        }
+        auto nConverted = vectorToRawSimd(&(*cooked_begin), cooked_end - cooked_begin, &(*raw_begin));
+        cooked_it += nConverted;
+        raw_begin += nConverted;
+      }
+    }
+
+    for(; cooked_it != cooked_end; ++cooked_it, ++raw_begin) {
+      *raw_begin = toRaw<CookedType>(*cooked_it);
+    }
+  }
+
   template<typename RAW_ITERATOR, typename COOKED_ITERATOR>
   struct IEEE754_SingleConverter::vectorToCooked_impl<std::string, RAW_ITERATOR, COOKED_ITERATOR> {
     static void impl(const RAW_ITERATOR& raw_begin, const RAW_ITERATOR& raw_end, COOKED_ITERATOR cooked_begin) {
@@ -6,12 +6,15 @@
 #include "DeviceBackendImpl.h"
 #include "InterruptControllerHandler.h"
 #include "NumericAddressedRegisterCatalogue.h"
+#include "RawBufferAllocator.h"
 #include "VersionNumber.h"
 
 #include <boost/pointer_cast.hpp>
 
+#include <exception>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace ChimeraTK {
 
@@ -91,6 +94,50 @@ namespace ChimeraTK {
      */
     virtual size_t minimumTransferAlignment([[maybe_unused]] uint64_t bar) const { return 1; }
 
+    /**
+     * @brief Determines the maximum gap between two address ranges which are still merged into a single request.
+     *
+     * Merging requests with a gap in between transfers the bytes in the gap unnecessarily, but saves the fixed
+     * overhead of an additional request (e.g. system call, DMA setup, network round trip). The returned value should
+     * hence correspond to the number of bytes which can be transferred in the time of the per-request overhead. Merging
+     * is done whenever the gap is not bigger than this value, i.e. whenever the wasted bytes are cheaper than the
+     * additional request.
+     *
+     * Only reads are merged across gaps. Writes of merged requests skip the gaps, since they may contain registers
+     * which are not part of the request (which might be written concurrently, or have side effects when written).
+     * Backends must hence only return a non-zero value if reading arbitrary registers of the bar has no side effects.
+     *
+     * This function is only relevant if canMergeRequests() returns true. The default implementation returns 0, which
+     * means that only adjacent or overlapping address ranges are merged.
+     *
+     * @return Maximum gap in bytes
+     */
+    virtual size_t maximumMergeGap([[maybe_unused]] uint64_t bar) const { return 0; }
+
+    /** A single read of readMultiple(). */
+    struct ReadRequest {
+      uint64_t bar;
+      uint64_t address;
+      int32_t* data;
+      size_t sizeInBytes;
+
+      /** ChimeraTK::runtime_error of this read, set by readMultiple() */
+      std::exception_ptr error{nullptr};
+    };
+
+    /**
+     * @brief Execute several independent reads, which the backend may have in flight at the same time.
+     *
+     * This is used by the TransferGroup for all low-level reads of this backend, so backends which can queue several
+     * transfers to the driver (e.g. DMA transfers submitted through io_uring) can override it to overlap the
+     * transfers.
+     *
+     * A ChimeraTK::runtime_error of a single read is stored in the error field of its request, and the other reads are
+     * still executed. A ChimeraTK::runtime_error or boost::thread_interrupted thrown by readMultiple() applies to all
+     * requests. The default implementation calls read() for each request in the given order.
+     */
+    virtual void readMultiple(std::vector<ReadRequest>& requests);
+
     RegisterCatalogue getRegisterCatalogue() const override;
 
     MetadataCatalogue getMetadataCatalogue() const override;
@@ -146,6 +193,29 @@ namespace ChimeraTK {
     /// mutex for protecting unaligned access
     std::mutex _unalignedAccess;
 
+    /// allocation policy for the buffers of the low-level transfer elements, backends set it from the CDD parameters
+    detail::RawBufferPolicy _rawBufferPolicy;
+
+    /// minimum number of samples of a multiplexed register for parallel data conversion, 0 disables it
+    size_t _parallelConversionThreshold{0};
+
+    /// configuration of the data transport queues of the asynchronous accessors, applied to all AsyncDomains
+    AsyncQueueConfig _asyncQueueConfig;
+
+    /**
+     * Apply the optional CDD parameters which are handled by the NumericAddressedBackend itself. Backends supporting
+     * them call this function in their createInstance(). The parameters are:
+     *  - "bufferAlignment" and "hugePages": allocation of the transfer buffers, see detail::RawBufferPolicy
+     *  - "parallelConversion": minimum number of samples (channels times elements) of a multiplexed register, from
+     *    which on the data of the channels is converted concurrently on the shared ThreadPool. Default is 0, which
+     *    disables the parallel conversion.
+     *  - "asyncQueueLength" and "asyncOverflowPolicy": queues of the accessors with AccessMode::wait_for_new_data, see
+     *    AsyncQueueConfig
+     *
+     * Throws ChimeraTK::logic_error on invalid parameter values.
+     */
+    void applyCommonParameters(const std::map<std::string, std::string>& parameters);
+
     template<typename UserType>
     boost::shared_ptr<NDRegisterAccessor<UserType>> getRegisterAccessor_impl(
         const RegisterPath& registerPathName, size_t numberOfWords, size_t wordOffsetInRegister, AccessModeFlags flags);
@@ -160,11 +230,14 @@ namespace ChimeraTK {
      *  Function to be called by implementing backend when an interrupt arrives. It usually is
      *  called from the interrupt handling thread.
      *
+     *  If the backend has merged several hardware interrupts into this call, it passes their number as nInterrupts. It
+     *  is delivered together with the data, see AsyncNDRegisterAccessor::getNumberOfCoalescedInterrupts().
+     *
      *  Throws std::out_of_range if an invalid interruptNumber is given as parameter.
      *
      *   @returns The version number that was send with all data in this interrupt.
      */
-    VersionNumber dispatchInterrupt(uint32_t interruptNumber);
+    VersionNumber dispatchInterrupt(uint32_t interruptNumber, uint32_t nInterrupts = 1);
 
    private:
     using AsyncDomainPtr_t = boost::weak_ptr<AsyncDomainImpl<TriggerDistributor, std::nullptr_t>>;
@@ -202,11 +202,7 @@ namespace ChimeraTK {
     void replaceTransferElement(boost::shared_ptr<TransferElement> newElement) override {
       auto casted = boost::dynamic_pointer_cast<NumericAddressedLowLevelTransferElement>(newElement);
       if(casted && casted->isMergeable(_rawAccessor)) {
-        size_t newStartAddress = std::min(casted->_startAddress, _rawAccessor->_startAddress);
-        size_t newStopAddress = std::max(
-            casted->_startAddress + casted->_numberOfBytes, _rawAccessor->_startAddress + _rawAccessor->_numberOfBytes);
-        size_t newNumberOfBytes = newStopAddress - newStartAddress;
-        casted->changeAddress(newStartAddress, newNumberOfBytes);
+        casted->mergeWith(*_rawAccessor);
         _rawAccessor = casted;
       }
       _rawAccessor->setExceptionBackend(this->_exceptionBackend);
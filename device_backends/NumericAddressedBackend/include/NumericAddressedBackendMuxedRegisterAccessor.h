@@ -7,9 +7,12 @@
 #include "NDRegisterAccessor.h"
 #include "NumericAddressedBackend.h"
 #include "NumericAddressedRegisterCatalogue.h"
+#include "ThreadPool.h"
 
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <sstream>
 
 namespace ChimeraTK {
@@ -63,6 +66,42 @@ namespace ChimeraTK {
       friend struct pitched_iterator;
     };
 
+    /**
+     * Transpose kernel for demultiplexing: copies a block of samples of all channels from the multiplexed raw data into
+     * a buffer holding the samples of each channel contiguously. The block should be small enough to stay in the cache,
+     * so the raw data is read only once for all channels.
+     *
+     * The raw value of each sample is provided as int32_t. Like when reading through a pitched_iterator<int32_t>, the
+     * upper bytes may contain data of other channels, which the data converters ignore. A specialised kernel is chosen
+     * in the constructor if all channels have the same raw width (8, 16 or 32 bits) and are packed without gaps. It
+     * fills the upper bytes with zeros instead.
+     */
+    class MuxedTransposer {
+     public:
+      MuxedTransposer() = default;
+
+      /** Offsets and widths of the channels in bytes, pitch of the samples in bytes */
+      MuxedTransposer(std::vector<size_t> channelOffsets, const std::vector<size_t>& channelWidths, size_t pitch);
+
+      /**
+       * Transpose nSamples samples starting at the given raw data. Sample k of channel c is written to
+       * target[c * stride + k]. For the last sample, up to 3 bytes behind its end may be read.
+       */
+      void transpose(const std::byte* raw, size_t nSamples, int32_t* target, size_t stride) const;
+
+     private:
+      enum class Kind { generic, packed8, packed16, packed32 };
+
+      template<typename RAW_TYPE>
+      void transposePacked(const std::byte* raw, size_t nSamples, int32_t* target, size_t stride) const;
+
+      void transposeGeneric(const std::byte* raw, size_t nSamples, int32_t* target, size_t stride) const;
+
+      Kind _kind{Kind::generic};
+      std::vector<size_t> _channelOffsets;
+      size_t _pitch{0};
+    };
+
   } // namespace detail
 
   /********************************************************************************************************************/
@@ -118,6 +157,35 @@ namespace ChimeraTK {
     std::vector<detail::pitched_iterator<int32_t>> _startIterators;
     std::vector<detail::pitched_iterator<int32_t>> _endIterators;
 
+    /** Kernel to demultiplex the _ioBuffer block-wise */
+    detail::MuxedTransposer _transposer;
+
+    /** Number of samples per block, chosen such that the raw data of one block fits into the L1 cache */
+    size_t _samplesPerBlock{1};
+
+    /** Buffer for the transposed raw data of one block (all channels) for the sequential conversion */
+    std::vector<int32_t> _transposeBuffer;
+
+    /**
+     * Tasks and their transpose buffers for the parallel conversion, one per sample range. Both are created on the
+     * first parallel conversion and reused afterwards, since the ranges only depend on the register size.
+     */
+    std::vector<std::function<void()>> _parallelTasks;
+    std::vector<std::vector<int32_t>> _parallelTransposeBuffers;
+
+    /**
+     * Convert the given range of samples of all channels from the _ioBuffer into buffer_2D. The range is processed in
+     * blocks of _samplesPerBlock, which are transposed into the given buffer (of _samplesPerBlock times the number of
+     * channels) and then converted channel by channel from contiguous memory.
+     */
+    void convertToCooked(size_t begin, size_t end, std::vector<int32_t>& transposeBuffer);
+
+    /**
+     * Convert all channels concurrently on the shared ThreadPool. The samples are split into one range per thread,
+     * each range is converted by convertToCooked() into its own buffer of _parallelTransposeBuffers.
+     */
+    void convertToCookedParallel();
+
     std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override {
       return {boost::enable_shared_from_this<TransferElement>::shared_from_this()};
     }
@@ -192,6 +260,18 @@ namespace ChimeraTK {
       _startIterators.emplace_back(ioBuffer + c.bitOffset / 8, _registerInfo.elementPitchBits / 8);
       _endIterators.push_back(_startIterators.back() + _registerInfo.nElements);
     }
+
+    // prepare the block-wise demultiplexing
+    std::vector<size_t> channelOffsets, channelWidths;
+    for(auto& c : _registerInfo.channels) {
+      channelOffsets.push_back(c.bitOffset / 8);
+      callForRawType(c.getRawType(), [&](auto x) { channelWidths.push_back(sizeof(x)); });
+    }
+    size_t pitch = _registerInfo.elementPitchBits / 8;
+    _transposer = detail::MuxedTransposer(std::move(channelOffsets), channelWidths, pitch);
+    constexpr size_t blockSizeInBytes = 16384;
+    _samplesPerBlock = std::clamp(blockSizeInBytes / std::max(pitch, size_t(1)), size_t(1), size_t(1024));
+    _transposeBuffer.resize(_samplesPerBlock * _converters.size());
   }
 
   /********************************************************************************************************************/
@@ -212,8 +292,12 @@ namespace ChimeraTK {
   void NumericAddressedBackendMuxedRegisterAccessor<UserType, ConverterType>::doPostRead(
       TransferType, bool hasNewData) {
     if(hasNewData) {
-      for(size_t i = 0; i < _converters.size(); ++i) {
-        _converters[i].template vectorToCooked<UserType>(_startIterators[i], _endIterators[i], buffer_2D[i].begin());
+      auto threshold = _ioDevice->_parallelConversionThreshold;
+      if(threshold > 0 && _converters.size() * _registerInfo.nElements >= threshold) {
+        convertToCookedParallel();
+      }
+      else {
+        convertToCooked(0, _registerInfo.nElements, _transposeBuffer);
       }
       // it is acceptable to create the version number in post read because this accessor does not have
       // wait_for_new_data. It is basically synchronous.
@@ -226,6 +310,57 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  template<class UserType, class ConverterType>
+  void NumericAddressedBackendMuxedRegisterAccessor<UserType, ConverterType>::convertToCooked(
+      size_t begin, size_t end, std::vector<int32_t>& transposeBuffer) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* ioBuffer = reinterpret_cast<const std::byte*>(_ioBuffer.data());
+    size_t pitch = _registerInfo.elementPitchBits / 8;
+
+    for(size_t blockBegin = begin; blockBegin < end; blockBegin += _samplesPerBlock) {
+      size_t nSamples = std::min(_samplesPerBlock, end - blockBegin);
+      _transposer.transpose(ioBuffer + blockBegin * pitch, nSamples, transposeBuffer.data(), _samplesPerBlock);
+      for(size_t i = 0; i < _converters.size(); ++i) {
+        const int32_t* channelBegin = transposeBuffer.data() + i * _samplesPerBlock;
+        _converters[i].template vectorToCooked<UserType>(
+            channelBegin, channelBegin + nSamples, buffer_2D[i].begin() + blockBegin);
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  template<class UserType, class ConverterType>
+  void NumericAddressedBackendMuxedRegisterAccessor<UserType, ConverterType>::convertToCookedParallel() {
+    auto& pool = ThreadPool::shared();
+
+    if(_parallelTasks.empty()) {
+      size_t nElements = _registerInfo.nElements;
+
+      // one range per thread (including the calling thread), consisting of full blocks
+      size_t nBlocks = (nElements + _samplesPerBlock - 1) / _samplesPerBlock;
+      size_t nTasks = std::min(pool.size() + 1, nBlocks);
+      size_t rangeSize = (nBlocks + nTasks - 1) / nTasks * _samplesPerBlock;
+
+      _parallelTasks.reserve(nTasks);
+      _parallelTransposeBuffers.reserve(nTasks);
+      for(size_t begin = 0; begin < nElements; begin += rangeSize) {
+        size_t end = std::min(begin + rangeSize, nElements);
+        auto& transposeBuffer = _parallelTransposeBuffers.emplace_back(_transposeBuffer.size());
+        _parallelTasks.emplace_back(
+            [this, begin, end, &transposeBuffer] { convertToCooked(begin, end, transposeBuffer); });
+      }
+    }
+
+    if(_parallelTasks.size() <= 1) {
+      convertToCooked(0, _registerInfo.nElements, _transposeBuffer);
+      return;
+    }
+    pool.runAll(_parallelTasks);
+  }
+
+  /********************************************************************************************************************/
+
   template<class UserType, class ConverterType>
   bool NumericAddressedBackendMuxedRegisterAccessor<UserType, ConverterType>::doWriteTransfer(VersionNumber) {
     assert(_registerInfo.elementPitchBits % 8 == 0);
@@ -29,7 +29,7 @@ namespace ChimeraTK {
     : NDRegisterAccessor<UserType>(registerPathName, flags), _dataConverter(registerPathName),
       _dev(boost::dynamic_pointer_cast<NumericAddressedBackend>(dev)) {
       // check for unknown flags
-      flags.checkForUnknownFlags({AccessMode::raw});
+      flags.checkForUnknownFlags({AccessMode::raw, AccessMode::zero_copy});
 
       // check device backend
       _dev = boost::dynamic_pointer_cast<NumericAddressedBackend>(dev);
@@ -108,6 +108,15 @@ namespace ChimeraTK {
         }
       }
 
+      if(flags.has(AccessMode::zero_copy)) {
+        if(!flags.has(AccessMode::raw)) {
+          throw ChimeraTK::logic_error("NumericAddressedBackendRegisterAccessor: AccessMode::zero_copy requires "
+                                       "AccessMode::raw (Register name: " +
+              registerPathName + "')");
+        }
+        _isZeroCopy = true;
+      }
+
       FILL_VIRTUAL_FUNCTION_TEMPLATE_VTABLE(getAsCooked_impl);
       FILL_VIRTUAL_FUNCTION_TEMPLATE_VTABLE(setAsCooked_impl);
     }
@@ -121,6 +130,10 @@ namespace ChimeraTK {
     }
 
     void doPostRead(TransferType type, bool hasNewData) override {
+      // the user buffer must never be used by the low-level element outside of our own transfer
+      bool dataIsInUserBuffer = _rawAccessor->_externalBuffer != nullptr;
+      _rawAccessor->_externalBuffer = nullptr;
+
       if(!_dev->isOpen()) return; // do not delegate if exception was thrown by us in doPreWrite
 
       _rawAccessor->setActiveException(this->_activeException);
@@ -135,7 +148,7 @@ namespace ChimeraTK {
           _dataConverter.template vectorToCooked<UserType>(itsrc, itsrc + buffer_2D[0].size(), buffer_2D[0].begin());
         });
       }
-      else {
+      else if(!dataIsInUserBuffer) {
         // optimised variant for raw transfers (unless type is a string)
         auto* itsrc = _rawAccessor->begin(_registerInfo.address);
         auto* itdst = buffer_2D[0].data();
@@ -153,6 +166,7 @@ namespace ChimeraTK {
       if(!_dev->isOpen()) throw ChimeraTK::logic_error("Device not opened.");
       // raw accessor preWrite must be called before our _prePostActionsImplementor.doPreWrite(), as it needs to
       // prepare the buffer in case of unaligned access and acquire the lock.
+      _rawAccessor->_externalBuffer = getZeroCopyBuffer();
       _rawAccessor->preWrite(type, versionNumber);
 
       if constexpr(!isRaw || std::is_same<UserType, std::string>::value) {
@@ -164,13 +178,10 @@ namespace ChimeraTK {
         callForRawType(_registerInfo.getDataDescriptor().rawDataType(), [this](auto t) {
           typedef decltype(t) RawType;
           auto itsrc = (RawType*)_rawAccessor->begin(_registerInfo.address);
-          for(auto itdst = buffer_2D[0].begin(); itdst != buffer_2D[0].end(); ++itdst) {
-            *itsrc = _dataConverter.template toRaw<UserType>(*itdst);
-            ++itsrc;
-          }
+          _dataConverter.template vectorToRaw<UserType>(buffer_2D[0].begin(), buffer_2D[0].end(), itsrc);
         });
       }
-      else {
+      else if(_rawAccessor->_externalBuffer == nullptr) {
         // optimised variant for raw transfers (unless type is a string)
         auto* itdst = _rawAccessor->begin(_registerInfo.address);
         auto itsrc = buffer_2D[0].begin();
@@ -182,10 +193,12 @@ namespace ChimeraTK {
 
     void doPreRead(TransferType type) override {
       if(!_dev->isOpen()) throw ChimeraTK::logic_error("Device not opened.");
+      _rawAccessor->_externalBuffer = getZeroCopyBuffer();
       _rawAccessor->preRead(type);
     }
 
     void doPostWrite(TransferType type, VersionNumber versionNumber) override {
+      _rawAccessor->_externalBuffer = nullptr;
       if(!_dev->isOpen()) return; // do not delegate if exception was thrown by us in doPreWrite
       _rawAccessor->setActiveException(this->_activeException);
       _rawAccessor->postWrite(type, versionNumber);
@@ -201,6 +214,10 @@ namespace ChimeraTK {
       return true;
     }
 
+    [[nodiscard]] std::pair<std::string, uint64_t> getReplacementKey() const override {
+      return {this->_name, _registerInfo.address};
+    }
+
     [[nodiscard]] bool isReadOnly() const override { return isReadable() && !isWriteable(); }
 
     [[nodiscard]] bool isReadable() const override { return _registerInfo.isReadable(); }
@@ -239,6 +256,26 @@ namespace ChimeraTK {
     /** the backend to use for the actual hardware access */
     boost::shared_ptr<NumericAddressedBackend> _dev;
 
+    /** flag whether AccessMode::zero_copy has been requested */
+    bool _isZeroCopy{false};
+
+    /** Return the user buffer to be used directly as transfer buffer by the low-level transfer element, or nullptr if
+     * the data has to be copied. Zero-copy transfers are only possible if the low-level element covers exactly our
+     * register, i.e. it is not shared with other accessors (by a TransferGroup) and no alignment padding was needed.
+     * The pointer is obtained at the beginning of each transfer, so the user buffer may be swapped between
+     * transfers. */
+    uint8_t* getZeroCopyBuffer() {
+      if constexpr(isRaw && !std::is_same<UserType, std::string>::value) {
+        if(_isZeroCopy && !_rawAccessor->isShared && !_rawAccessor->_isUnaligned &&
+            _rawAccessor->_startAddress == _registerInfo.address &&
+            _rawAccessor->_numberOfBytes == buffer_2D[0].size() * sizeof(UserType)) {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          return reinterpret_cast<uint8_t*>(buffer_2D[0].data());
+        }
+      }
+      return nullptr;
+    }
+
     std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override {
       return _rawAccessor->getHardwareAccessingElements();
     }
@@ -250,11 +287,7 @@ namespace ChimeraTK {
     void replaceTransferElement(boost::shared_ptr<TransferElement> newElement) override {
       auto casted = boost::dynamic_pointer_cast<NumericAddressedLowLevelTransferElement>(newElement);
       if(casted && casted->isMergeable(_rawAccessor)) {
-        size_t newStartAddress = std::min(casted->_startAddress, _rawAccessor->_startAddress);
-        size_t newStopAddress = std::max(
-            casted->_startAddress + casted->_numberOfBytes, _rawAccessor->_startAddress + _rawAccessor->_numberOfBytes);
-        size_t newNumberOfBytes = newStopAddress - newStartAddress;
-        casted->changeAddress(newStartAddress, newNumberOfBytes);
+        casted->mergeWith(*_rawAccessor);
         _rawAccessor = casted;
       }
       _rawAccessor->setExceptionBackend(this->_exceptionBackend);
@@ -5,6 +5,11 @@
 #include "NumericAddressedBackend.h"
 #include "TransferElement.h"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace ChimeraTK {
 
   template<typename UserType, typename DataConverterType, bool isRaw>
@@ -32,13 +37,15 @@ namespace ChimeraTK {
     NumericAddressedLowLevelTransferElement(
         const boost::shared_ptr<NumericAddressedBackend>& dev, size_t bar, size_t startAddress, size_t numberOfBytes)
     : TransferElement("", {AccessMode::raw}), _dev(dev), _bar(bar),
-      _unalignedAccess(_dev->_unalignedAccess, std::defer_lock) {
+      _unalignedAccess(_dev->_unalignedAccess, std::defer_lock),
+      rawDataBuffer(detail::RawBufferAllocator<uint8_t>(_dev->_rawBufferPolicy)) {
       if(!dev->barIndexValid(bar)) {
         std::stringstream errorMessage;
         errorMessage << "Invalid bar number: " << bar << std::endl;
         throw ChimeraTK::logic_error(errorMessage.str());
       }
       setAddress(startAddress, numberOfBytes);
+      _writtenRanges = {{_startAddress, _numberOfBytes}};
     }
 
     ~NumericAddressedLowLevelTransferElement() override = default;
@@ -46,13 +53,18 @@ namespace ChimeraTK {
     void doReadTransferSynchronously() override {
       // There is nothing we can do about reinterpet_casting with the C-style interface
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
+      _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(transferBuffer()), _numberOfBytes);
     }
 
     bool doWriteTransfer(ChimeraTK::VersionNumber) override {
-      // There is nothing we can do about reinterpet_casting with the C-style interface
-      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-      _dev->write(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
+      // Gaps between merged areas are never written, since they may contain registers which are not part of the
+      // TransferGroup (and which may be written concurrently by others, or have side effects when written).
+      for(const auto& [address, numberOfBytes] : _writtenRanges) {
+        // There is nothing we can do about reinterpet_casting with the C-style interface
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        _dev->write(_bar, address, reinterpret_cast<int32_t*>(transferBuffer() + (address - _startAddress)),
+            numberOfBytes);
+      }
       return false;
     }
 
@@ -69,7 +81,7 @@ namespace ChimeraTK {
         _unalignedAccess.lock();
         // There is nothing we can do about reinterpet_casting with the C-style interface
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(rawDataBuffer.data()), _numberOfBytes);
+        _dev->read(_bar, _startAddress, reinterpret_cast<int32_t*>(transferBuffer()), _numberOfBytes);
       }
     }
 
@@ -79,7 +91,8 @@ namespace ChimeraTK {
       }
     }
 
-    /** Check if the address areas are adjacent and/or overlapping.
+    /** Check if the address areas are adjacent and/or overlapping, or separated by a gap not bigger than
+     *  NumericAddressedBackend::maximumMergeGap().
      *  NumericAddressedBackendRegisterAccessor::replaceTransferElement() takes
      * care of replacing the NumericAddressedBackendRawAccessors with a single
      * NumericAddressedBackendRawAccessor covering the address space of both
@@ -93,16 +106,33 @@ namespace ChimeraTK {
       if(_dev != rhsCasted->_dev) return false;
       if(_bar != rhsCasted->_bar) return false;
 
-      // only allow adjacent and overlapping address areas to be merged
-      if(_startAddress + _numberOfBytes < rhsCasted->_startAddress) return false;
-      if(_startAddress > rhsCasted->_startAddress + rhsCasted->_numberOfBytes) return false;
-      return true;
+      // only allow adjacent and overlapping address areas, or areas with a small enough gap to be merged
+      return gapTo(*rhsCasted) <= _dev->maximumMergeGap(_bar);
+    }
+
+    /** Return the number of bytes between the address area of this and the other element. Returns 0 if the areas are
+     *  adjacent or overlapping. Both elements must belong to the same bar. */
+    size_t gapTo(const NumericAddressedLowLevelTransferElement& other) const {
+      if(_startAddress + _numberOfBytes < other._startAddress) {
+        return other._startAddress - (_startAddress + _numberOfBytes);
+      }
+      if(_startAddress > other._startAddress + other._numberOfBytes) {
+        return _startAddress - (other._startAddress + other._numberOfBytes);
+      }
+      return 0;
     }
 
     bool mayReplaceOther(const boost::shared_ptr<TransferElement const>&) const override {
       return false; // never used, since isMergeable() is used instead
     }
 
+    std::pair<std::string, uint64_t> getReplacementKey() const override {
+      // Only elements of the same backend and bar can be merged (see isMergeable()), in the order of their address.
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      auto backendId = reinterpret_cast<uintptr_t>(_dev.get());
+      return {"NALLTE@" + std::to_string(backendId) + ":" + std::to_string(_bar), _startAddress};
+    }
+
     const std::type_info& getValueType() const override {
       // This implementation is for int32_t only (as all numerically addressed
       // backends under the hood.
@@ -124,6 +154,19 @@ namespace ChimeraTK {
      * Otherwise an undefined behaviour will occur! */
     uint8_t* begin(size_t addressInBar) { return rawDataBuffer.data() + (addressInBar - _startAddress); }
 
+    /** Return pointer to the buffer used for the next transfer. This is the user buffer of the accessor set in
+     * _externalBuffer for zero-copy transfers, otherwise the rawDataBuffer. */
+    uint8_t* transferBuffer() { return _externalBuffer ? _externalBuffer : rawDataBuffer.data(); }
+
+    /** Return the read request for NumericAddressedBackend::readMultiple() which corresponds to
+     * doReadTransferSynchronously(). */
+    NumericAddressedBackend::ReadRequest getReadRequest() {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      return {_bar, _startAddress, reinterpret_cast<int32_t*>(transferBuffer()), _numberOfBytes};
+    }
+
+    std::unique_ptr<ReadBatch> createReadBatch() override { return std::make_unique<NumericAddressedReadBatch>(*this); }
+
     /** Change the start address (inside the bar given in the constructor) and
      * number of words of this accessor,  and set the shared flag. */
     void changeAddress(size_t startAddress, size_t numberOfWords) {
@@ -131,12 +174,82 @@ namespace ChimeraTK {
       isShared = true;
     }
 
+    /** Merge the other element into this element: change the address range so it covers both elements (see
+     * changeAddress()), and add the ranges written by the other element to the ranges written by this element. */
+    void mergeWith(const NumericAddressedLowLevelTransferElement& other) {
+      size_t newStartAddress = std::min(_startAddress, other._startAddress);
+      size_t newStopAddress = std::max(_startAddress + _numberOfBytes, other._startAddress + other._numberOfBytes);
+      changeAddress(newStartAddress, newStopAddress - newStartAddress);
+
+      // keep the written ranges sorted, and combine adjacent and overlapping ranges
+      std::vector<std::pair<uint64_t, size_t>> ranges = _writtenRanges;
+      ranges.insert(ranges.end(), other._writtenRanges.begin(), other._writtenRanges.end());
+      std::sort(ranges.begin(), ranges.end());
+      _writtenRanges.clear();
+      for(const auto& [address, numberOfBytes] : ranges) {
+        if(!_writtenRanges.empty() && address <= _writtenRanges.back().first + _writtenRanges.back().second) {
+          auto& last = _writtenRanges.back();
+          last.second = std::max(last.second, size_t(address + numberOfBytes - last.first));
+        }
+        else {
+          _writtenRanges.emplace_back(address, numberOfBytes);
+        }
+      }
+    }
+
     boost::shared_ptr<TransferElement> makeCopyRegisterDecorator() override { // LCOV_EXCL_LINE
       throw ChimeraTK::logic_error("NumericAddressedLowLevelTransferElement::makeCopyRegisterDecorator() "
                                    "is not implemented"); // LCOV_EXCL_LINE
     }                                                     // LCOV_EXCL_LINE
 
    protected:
+    /** ReadBatch passing the reads of all elements of the same backend to NumericAddressedBackend::readMultiple(). */
+    class NumericAddressedReadBatch : public ReadBatch {
+     public:
+      explicit NumericAddressedReadBatch(NumericAddressedLowLevelTransferElement& first) : _dev(first._dev) {
+        _elements.push_back(
+            boost::static_pointer_cast<NumericAddressedLowLevelTransferElement>(first.shared_from_this()));
+        _requests.resize(1);
+      }
+
+      bool add(const boost::shared_ptr<TransferElement>& element) override {
+        auto casted = boost::dynamic_pointer_cast<NumericAddressedLowLevelTransferElement>(element);
+        if(!casted || casted->_dev != _dev) return false;
+        _elements.push_back(casted);
+        _requests.resize(_elements.size());
+        return true;
+      }
+
+      [[nodiscard]] size_t size() const override { return _elements.size(); }
+
+      void readTransfer() override {
+        // The requests are obtained freshly for each transfer, since the transfer buffer may change (zero-copy).
+        for(size_t i = 0; i < _elements.size(); ++i) {
+          _requests[i] = _elements[i]->getReadRequest();
+        }
+        std::exception_ptr commonError{nullptr};
+        try {
+          _dev->readMultiple(_requests);
+        }
+        catch(ChimeraTK::runtime_error&) {
+          commonError = std::current_exception();
+        }
+        catch(boost::thread_interrupted&) {
+          // Like other exceptions, this is stored in all elements, so it is seen by all of them in postRead().
+          commonError = std::current_exception();
+        }
+        for(size_t i = 0; i < _elements.size(); ++i) {
+          auto error = commonError ? commonError : _requests[i].error;
+          _elements[i]->setActiveException(error);
+        }
+      }
+
+     private:
+      boost::shared_ptr<NumericAddressedBackend> _dev;
+      std::vector<boost::shared_ptr<NumericAddressedLowLevelTransferElement>> _elements;
+      std::vector<NumericAddressedBackend::ReadRequest> _requests;
+    };
+
     /** Set the start address (inside the bar given in the constructor) and number
      * of words of this accessor. */
     void setAddress(size_t startAddress, size_t numberOfBytes) {
@@ -184,11 +297,21 @@ namespace ChimeraTK {
     /** flag whether access is unaligned */
     bool _isUnaligned{false};
 
+    /** Address ranges (start address and number of bytes) which are actually used by the accessors of this element.
+     * This is a single range equal to the full range, unless areas with gaps in between have been merged. Only these
+     * ranges are written, while the full range is read. */
+    std::vector<std::pair<uint64_t, size_t>> _writtenRanges;
+
     /** Lock to protect unaligned access (with mutex from backend) */
     std::unique_lock<std::mutex> _unalignedAccess;
 
-    /** raw buffer */
-    std::vector<uint8_t> rawDataBuffer;
+    /** raw buffer, allocated according to the RawBufferPolicy of the backend */
+    std::vector<uint8_t, detail::RawBufferAllocator<uint8_t>> rawDataBuffer;
+
+    /** Buffer to transfer the data from/to instead of the rawDataBuffer, if not nullptr. This is set by the
+     * NumericAddressedBackendRegisterAccessor for the duration of a single transfer only, if AccessMode::zero_copy is
+     * used and this element is neither shared nor unaligned. It must then point to a buffer of _numberOfBytes. */
+    uint8_t* _externalBuffer{nullptr};
 
     std::vector<boost::shared_ptr<TransferElement>> getHardwareAccessingElements() override {
       return {boost::enable_shared_from_this<TransferElement>::shared_from_this()};
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace ChimeraTK::detail {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Allocation policy for the buffers of the low-level data transfers of the NumericAddressedBackend.
+   *
+   * The policy can be configured per device through the following CDD parameters (supported by the backends which
+   * document it):
+   *  - "bufferAlignment": alignment of the buffers in bytes, must be a power of two up to hugePageSize (default 64,
+   *    i.e. a cache line)
+   *  - "hugePages": if set to "1", buffers of at least hugePageSize are backed by huge pages. Explicit huge pages
+   *    (MAP_HUGETLB) are tried first, transparent huge pages (madvise) are used if none are available.
+   */
+  struct RawBufferPolicy {
+    size_t alignment{64};
+    bool hugePages{false};
+
+    /** Size of the huge pages. Smaller buffers are always allocated normally. */
+    static constexpr size_t hugePageSize{2 * 1024 * 1024};
+
+    /** Create policy from the CDD parameters. Throws ChimeraTK::logic_error on invalid values. */
+    static RawBufferPolicy fromParameters(const std::map<std::string, std::string>& parameters);
+
+    bool operator==(const RawBufferPolicy& other) const {
+      return alignment == other.alignment && hugePages == other.hugePages;
+    }
+    bool operator!=(const RawBufferPolicy& other) const { return !operator==(other); }
+  };
+
+  /** Allocate buffer of the given size according to the policy. Throws std::bad_alloc on failure. */
+  void* allocateRawBuffer(size_t sizeInBytes, const RawBufferPolicy& policy);
+
+  /** Free buffer obtained by allocateRawBuffer(). Size and policy must be identical to the allocation. */
+  void deallocateRawBuffer(void* buffer, size_t sizeInBytes, const RawBufferPolicy& policy) noexcept;
+
+  /********************************************************************************************************************/
+
+  /**
+   * Allocator for std::vector using allocateRawBuffer()/deallocateRawBuffer() with the given policy.
+   */
+  template<typename T>
+  class RawBufferAllocator {
+   public:
+    using value_type = T;
+
+    RawBufferAllocator() = default;
+
+    explicit RawBufferAllocator(const RawBufferPolicy& policy) : _policy(policy) {}
+
+    template<typename U>
+    // NOLINTNEXTLINE(google-explicit-constructor) - required by the allocator concept
+    RawBufferAllocator(const RawBufferAllocator<U>& other) : _policy(other.policy()) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(allocateRawBuffer(n * sizeof(T), _policy)); }
+
+    void deallocate(T* p, size_t n) noexcept { deallocateRawBuffer(p, n * sizeof(T), _policy); }
+
+    [[nodiscard]] const RawBufferPolicy& policy() const { return _policy; }
+
+    template<typename U>
+    bool operator==(const RawBufferAllocator<U>& other) const {
+      return _policy == other.policy();
+    }
+    template<typename U>
+    bool operator!=(const RawBufferAllocator<U>& other) const {
+      return _policy != other.policy();
+    }
+
+   private:
+    RawBufferPolicy _policy;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
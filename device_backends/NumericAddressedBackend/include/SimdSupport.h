@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace ChimeraTK::detail {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Instruction set extensions used by the vectorised data conversion kernels. The kernels are compiled through
+   * function target attributes, so the library does not need to be compiled for a specific CPU.
+   */
+  enum class SimdLevel { none, sse41, avx2 };
+
+  /**
+   * Return the instruction set extension to be used by the kernels. This is the best extension supported by the CPU
+   * (see getSupportedSimdLevel()), unless a lower level has been set with setSimdLevelForTesting().
+   */
+  SimdLevel getSimdLevel();
+
+  /** Return the best instruction set extension supported by the CPU. Always SimdLevel::none on non-x86 systems. */
+  SimdLevel getSupportedSimdLevel();
+
+  /**
+   * Select the instruction set extension used by the kernels, so the kernels of all levels can be tested on the same
+   * machine. Throws ChimeraTK::logic_error if the level is not supported by the CPU. Pass getSupportedSimdLevel() to
+   * restore the default. This is only meant for tests and must not be called while conversions are running.
+   */
+  void setSimdLevelForTesting(SimdLevel level);
+
+  /********************************************************************************************************************/
+
+  /** Check whether the iterator is known to point into contiguous memory (pointer or std::vector iterator) */
+  template<typename ITERATOR, typename VALUE_TYPE = typename std::iterator_traits<ITERATOR>::value_type>
+  constexpr bool isContiguousIterator = std::is_pointer<ITERATOR>::value ||
+      std::is_same<ITERATOR, typename std::vector<VALUE_TYPE>::iterator>::value ||
+      std::is_same<ITERATOR, typename std::vector<VALUE_TYPE>::const_iterator>::value;
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
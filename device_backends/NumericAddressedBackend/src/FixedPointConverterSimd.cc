@@ -0,0 +1,433 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Vectorised conversion kernels of the FixedPointConverter.
+ *
+ * The kernels are compiled for AVX2 and SSE4.1 through function attributes and selected at runtime (see SimdSupport.h).
+ * On other architectures or CPUs without SSE4.1 the kernels do not convert anything and the generic implementation in
+ * FixedPointConverter.h is used.
+ *
+ * All kernels produce bit-identical results to the generic implementation:
+ *  - toCooked: The raw value is sign-extended resp. masked to nBits (which is what padUnusedBits() and the 16-bit
+ *    special cases do), converted exactly into double and multiplied with 2^-fractionalBits. This product is exact,
+ *    since the coefficient is a power of two within the dynamic range checked in reconfigure(). Floats are obtained by
+ *    a single rounding of that product, like the static_cast in numericToUserType<float>().
+ *  - toRaw: The range check against the minimum and maximum cooked values and the rounding (half away from zero) are
+ *    done like in toRaw(). Blocks containing values which cannot be converted directly (NaN, rounding overflows) are
+ *    passed to toRaw() element by element, so also the corner cases behave identically.
+ */
+
+#include "FixedPointConverter.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <immintrin.h>
+#  define CHIMERATK_FIXEDPOINT_SIMD
+#endif
+
+namespace ChimeraTK {
+
+#ifdef CHIMERATK_FIXEDPOINT_SIMD
+
+  namespace {
+
+    /******************************************************************************************************************/
+
+    /// Parameters of the conversion, precomputed once per call
+    struct Parameters {
+      bool isSigned;
+      bool isUnsigned32; ///< Unsigned with 32 bits: the padded raw value must be interpreted as uint32_t
+      int32_t shift;     ///< Number of unused bits, used for sign extension
+      int32_t usedBitsMask;
+      double coefficient;
+      double minCooked, maxCooked;
+      double minRaw, maxRaw; ///< Minimum and maximum raw values (interpreted with the proper signedness)
+      double lowestRaw, highestRaw; ///< Range of the raw type the rounded value is converted into before masking
+    };
+
+    /******************************************************************************************************************/
+    /* AVX2 implementation                                                                                            */
+    /******************************************************************************************************************/
+
+    template<typename RawType>
+    __attribute__((target("avx2"))) __m256i loadRawAvx2(const RawType* raw) {
+      if constexpr(std::is_same<RawType, int16_t>::value) {
+        return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(raw)));
+      }
+      else {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(raw));
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("avx2"))) __m256d toDoubleAvx2(const Parameters& p, __m128i v) {
+      if(p.isUnsigned32) {
+        // flip the sign bit to convert as signed value, then shift the result by 2^31
+        v = _mm_xor_si128(v, _mm_set1_epi32(INT32_MIN));
+        return _mm256_add_pd(_mm256_cvtepi32_pd(v), _mm256_set1_pd(2147483648.));
+      }
+      return _mm256_cvtepi32_pd(v);
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename RawType, typename UserType>
+    __attribute__((target("avx2"))) size_t toCookedAvx2(
+        const Parameters& p, const RawType* raw, size_t n, UserType* cooked) {
+      const __m128i shift = _mm_cvtsi32_si128(p.shift);
+      const __m256i usedBitsMask = _mm256_set1_epi32(p.usedBitsMask);
+      const __m256d coefficient = _mm256_set1_pd(p.coefficient);
+
+      size_t i = 0;
+      for(; i + 8 <= n; i += 8) {
+        __m256i v = loadRawAvx2(raw + i);
+
+        // same as padUnusedBits()
+        if(p.isSigned) {
+          v = _mm256_sra_epi32(_mm256_sll_epi32(v, shift), shift);
+        }
+        else {
+          v = _mm256_and_si256(v, usedBitsMask);
+        }
+
+        if constexpr(std::is_same<UserType, int32_t>::value) {
+          // unsigned values above the int32_t range saturate (cf. numericToUserType())
+          if(p.isUnsigned32) v = _mm256_min_epu32(v, _mm256_set1_epi32(INT32_MAX));
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(cooked + i), v);
+        }
+        else {
+          __m256d lo = _mm256_mul_pd(toDoubleAvx2(p, _mm256_castsi256_si128(v)), coefficient);
+          __m256d hi = _mm256_mul_pd(toDoubleAvx2(p, _mm256_extracti128_si256(v, 1)), coefficient);
+          if constexpr(std::is_same<UserType, double>::value) {
+            _mm256_storeu_pd(cooked + i, lo);
+            _mm256_storeu_pd(cooked + i + 4, hi);
+          }
+          else {
+            _mm_storeu_ps(cooked + i, _mm256_cvtpd_ps(lo));
+            _mm_storeu_ps(cooked + i + 4, _mm256_cvtpd_ps(hi));
+          }
+        }
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename UserType>
+    __attribute__((target("avx2"))) __m256d loadCookedAvx2(const UserType* cooked) {
+      if constexpr(std::is_same<UserType, double>::value) {
+        return _mm256_loadu_pd(cooked);
+      }
+      else if constexpr(std::is_same<UserType, float>::value) {
+        return _mm256_cvtps_pd(_mm_loadu_ps(cooked));
+      }
+      else {
+        return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(cooked)));
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename RawType>
+    __attribute__((target("avx2"))) void storeRawAvx2(RawType* raw, __m128i v) {
+      if constexpr(std::is_same<RawType, int16_t>::value) {
+        // truncate to the lower 16 bits, like the implicit conversion of the generic implementation
+        const __m128i lowerHalves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(raw), _mm_shuffle_epi8(v, lowerHalves));
+      }
+      else {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(raw), v);
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename UserType, typename RawType>
+    __attribute__((target("avx2"))) size_t toRawAvx2(const FixedPointConverter& fpc, const Parameters& p,
+        const UserType* cooked, size_t n, RawType* raw) {
+      const __m256d coefficient = _mm256_set1_pd(p.coefficient);
+      const __m256d minCooked = _mm256_set1_pd(p.minCooked);
+      const __m256d maxCooked = _mm256_set1_pd(p.maxCooked);
+      const __m256d minRaw = _mm256_set1_pd(p.minRaw);
+      const __m256d maxRaw = _mm256_set1_pd(p.maxRaw);
+      const __m256d lowestRaw = _mm256_set1_pd(p.lowestRaw);
+      const __m256d highestRaw = _mm256_set1_pd(p.highestRaw);
+      const __m256d half = _mm256_set1_pd(0.5);
+      const __m256d one = _mm256_set1_pd(1.);
+      const __m256d signBit = _mm256_set1_pd(-0.);
+      const __m128i usedBitsMask = _mm_set1_epi32(p.usedBitsMask);
+
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m256d c = loadCookedAvx2(cooked + i);
+        __m256d isBelow = _mm256_cmp_pd(c, minCooked, _CMP_LT_OQ);
+        __m256d isAbove = _mm256_cmp_pd(c, maxCooked, _CMP_GT_OQ);
+
+        // scale and round half away from zero
+        __m256d d = _mm256_mul_pd(c, coefficient);
+        __m256d r = _mm256_round_pd(d, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256d needsIncrement = _mm256_cmp_pd(_mm256_andnot_pd(signBit, _mm256_sub_pd(d, r)), half, _CMP_GE_OQ);
+        __m256d increment = _mm256_or_pd(_mm256_and_pd(d, signBit), one);
+        r = _mm256_add_pd(r, _mm256_and_pd(needsIncrement, increment));
+
+        // range check
+        r = _mm256_blendv_pd(r, minRaw, isBelow);
+        r = _mm256_blendv_pd(r, maxRaw, isAbove);
+
+        // NaN and values which would overflow the conversion are left to the generic implementation
+        __m256d isValid =
+            _mm256_and_pd(_mm256_cmp_pd(r, lowestRaw, _CMP_GE_OQ), _mm256_cmp_pd(r, highestRaw, _CMP_LE_OQ));
+        if(_mm256_movemask_pd(isValid) != 0xF) {
+          for(size_t k = i; k < i + 4; ++k) {
+            raw[k] = static_cast<RawType>(fpc.toRaw<UserType>(cooked[k]));
+          }
+          continue;
+        }
+
+        __m128i v;
+        if(p.isSigned) {
+          v = _mm256_cvttpd_epi32(r);
+        }
+        else {
+          v = _mm256_cvttpd_epi32(_mm256_sub_pd(r, _mm256_set1_pd(2147483648.)));
+          v = _mm_xor_si128(v, _mm_set1_epi32(INT32_MIN));
+        }
+        storeRawAvx2(raw + i, _mm_and_si128(v, usedBitsMask));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+    /* SSE4.1 implementation                                                                                          */
+    /******************************************************************************************************************/
+
+    template<typename RawType>
+    __attribute__((target("sse4.1"))) __m128i loadRawSse41(const RawType* raw) {
+      if constexpr(std::is_same<RawType, int16_t>::value) {
+        return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(raw)));
+      }
+      else {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(raw));
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("sse4.1"))) __m128d toDoubleSse41(const Parameters& p, __m128i v) {
+      if(p.isUnsigned32) {
+        v = _mm_xor_si128(v, _mm_set1_epi32(INT32_MIN));
+        return _mm_add_pd(_mm_cvtepi32_pd(v), _mm_set1_pd(2147483648.));
+      }
+      return _mm_cvtepi32_pd(v);
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename RawType, typename UserType>
+    __attribute__((target("sse4.1"))) size_t toCookedSse41(
+        const Parameters& p, const RawType* raw, size_t n, UserType* cooked) {
+      const __m128i shift = _mm_cvtsi32_si128(p.shift);
+      const __m128i usedBitsMask = _mm_set1_epi32(p.usedBitsMask);
+      const __m128d coefficient = _mm_set1_pd(p.coefficient);
+
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m128i v = loadRawSse41(raw + i);
+
+        if(p.isSigned) {
+          v = _mm_sra_epi32(_mm_sll_epi32(v, shift), shift);
+        }
+        else {
+          v = _mm_and_si128(v, usedBitsMask);
+        }
+
+        if constexpr(std::is_same<UserType, int32_t>::value) {
+          if(p.isUnsigned32) v = _mm_min_epu32(v, _mm_set1_epi32(INT32_MAX));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(cooked + i), v);
+        }
+        else {
+          __m128d lo = _mm_mul_pd(toDoubleSse41(p, v), coefficient);
+          __m128d hi = _mm_mul_pd(toDoubleSse41(p, _mm_srli_si128(v, 8)), coefficient);
+          if constexpr(std::is_same<UserType, double>::value) {
+            _mm_storeu_pd(cooked + i, lo);
+            _mm_storeu_pd(cooked + i + 2, hi);
+          }
+          else {
+            _mm_storeu_ps(cooked + i, _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)));
+          }
+        }
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename UserType>
+    __attribute__((target("sse4.1"))) void loadCookedSse41(const UserType* cooked, __m128d& lo, __m128d& hi) {
+      if constexpr(std::is_same<UserType, double>::value) {
+        lo = _mm_loadu_pd(cooked);
+        hi = _mm_loadu_pd(cooked + 2);
+      }
+      else if constexpr(std::is_same<UserType, float>::value) {
+        __m128 v = _mm_loadu_ps(cooked);
+        lo = _mm_cvtps_pd(v);
+        hi = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+      }
+      else {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cooked));
+        lo = _mm_cvtepi32_pd(v);
+        hi = _mm_cvtepi32_pd(_mm_srli_si128(v, 8));
+      }
+    }
+
+    /******************************************************************************************************************/
+
+    /// Scale, round and range check two values. Returns false if the values cannot be converted directly.
+    __attribute__((target("sse4.1"))) bool toRoundedRawSse41(const Parameters& p, __m128d& c) {
+      const __m128d signBit = _mm_set1_pd(-0.);
+      __m128d isBelow = _mm_cmplt_pd(c, _mm_set1_pd(p.minCooked));
+      __m128d isAbove = _mm_cmpgt_pd(c, _mm_set1_pd(p.maxCooked));
+
+      __m128d d = _mm_mul_pd(c, _mm_set1_pd(p.coefficient));
+      __m128d r = _mm_round_pd(d, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+      __m128d needsIncrement = _mm_cmpge_pd(_mm_andnot_pd(signBit, _mm_sub_pd(d, r)), _mm_set1_pd(0.5));
+      __m128d increment = _mm_or_pd(_mm_and_pd(d, signBit), _mm_set1_pd(1.));
+      r = _mm_add_pd(r, _mm_and_pd(needsIncrement, increment));
+
+      r = _mm_blendv_pd(r, _mm_set1_pd(p.minRaw), isBelow);
+      r = _mm_blendv_pd(r, _mm_set1_pd(p.maxRaw), isAbove);
+
+      __m128d isValid =
+          _mm_and_pd(_mm_cmpge_pd(r, _mm_set1_pd(p.lowestRaw)), _mm_cmple_pd(r, _mm_set1_pd(p.highestRaw)));
+      c = r;
+      return _mm_movemask_pd(isValid) == 0x3;
+    }
+
+    /******************************************************************************************************************/
+
+    template<typename UserType, typename RawType>
+    __attribute__((target("sse4.1"))) size_t toRawSse41(const FixedPointConverter& fpc, const Parameters& p,
+        const UserType* cooked, size_t n, RawType* raw) {
+      const __m128i usedBitsMask = _mm_set1_epi32(p.usedBitsMask);
+      const __m128d offset = _mm_set1_pd(p.isSigned ? 0. : 2147483648.);
+      const __m128i signFlip = _mm_set1_epi32(p.isSigned ? 0 : INT32_MIN);
+
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m128d lo, hi;
+        loadCookedSse41(cooked + i, lo, hi);
+        bool isValidLo = toRoundedRawSse41(p, lo);
+        bool isValidHi = toRoundedRawSse41(p, hi);
+        if(!isValidLo || !isValidHi) {
+          for(size_t k = i; k < i + 4; ++k) {
+            raw[k] = static_cast<RawType>(fpc.toRaw<UserType>(cooked[k]));
+          }
+          continue;
+        }
+
+        // unsigned values are shifted into the signed range for the conversion
+        __m128i v = _mm_unpacklo_epi64(
+            _mm_cvttpd_epi32(_mm_sub_pd(lo, offset)), _mm_cvttpd_epi32(_mm_sub_pd(hi, offset)));
+        v = _mm_and_si128(_mm_xor_si128(v, signFlip), usedBitsMask);
+
+        if constexpr(std::is_same<RawType, int16_t>::value) {
+          const __m128i lowerHalves = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(raw + i), _mm_shuffle_epi8(v, lowerHalves));
+        }
+        else {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(raw + i), v);
+        }
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+  } // namespace
+
+#endif // CHIMERATK_FIXEDPOINT_SIMD
+
+  /********************************************************************************************************************/
+
+  template<typename RawType, typename UserType>
+  size_t FixedPointConverter::vectorToCookedSimd(
+      [[maybe_unused]] const RawType* raw, [[maybe_unused]] size_t n, [[maybe_unused]] UserType* cooked) const {
+#ifdef CHIMERATK_FIXEDPOINT_SIMD
+    // integer user types are only supported without fractional bits, since the rounding is done by the generic code
+    if(std::is_same<UserType, int32_t>::value && _fractionalBits != 0) return 0;
+
+    Parameters p{};
+    p.isSigned = _isSigned;
+    p.isUnsigned32 = !_isSigned && _nBits == 32;
+    p.shift = 32 - static_cast<int32_t>(_nBits);
+    p.usedBitsMask = _usedBitsMask;
+    p.coefficient = _fractionalBitsCoefficient;
+
+    switch(detail::getSimdLevel()) {
+      case detail::SimdLevel::avx2:
+        return toCookedAvx2(p, raw, n, cooked);
+      case detail::SimdLevel::sse41:
+        return toCookedSse41(p, raw, n, cooked);
+      case detail::SimdLevel::none:
+        break;
+    }
+#endif
+    return 0;
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename UserType, typename RawType>
+  size_t FixedPointConverter::vectorToRawSimd(
+      [[maybe_unused]] const UserType* cooked, [[maybe_unused]] size_t n, [[maybe_unused]] RawType* raw) const {
+#ifdef CHIMERATK_FIXEDPOINT_SIMD
+    Parameters p{};
+    p.isSigned = _isSigned;
+    p.usedBitsMask = _usedBitsMask;
+    p.coefficient = _inverseFractionalBitsCoefficient;
+    p.minCooked = static_cast<double>(boost::fusion::at_key<UserType>(_minCookedValues));
+    p.maxCooked = static_cast<double>(boost::fusion::at_key<UserType>(_maxCookedValues));
+    if(_isSigned) {
+      p.minRaw = _minRawValue;
+      p.maxRaw = _maxRawValue;
+      p.lowestRaw = std::numeric_limits<int32_t>::min();
+      p.highestRaw = std::numeric_limits<int32_t>::max();
+    }
+    else {
+      p.minRaw = static_cast<uint32_t>(_minRawValue);
+      p.maxRaw = static_cast<uint32_t>(_maxRawValue);
+      p.lowestRaw = 0.;
+      p.highestRaw = std::numeric_limits<uint32_t>::max();
+    }
+
+    switch(detail::getSimdLevel()) {
+      case detail::SimdLevel::avx2:
+        return toRawAvx2(*this, p, cooked, n, raw);
+      case detail::SimdLevel::sse41:
+        return toRawSse41(*this, p, cooked, n, raw);
+      case detail::SimdLevel::none:
+        break;
+    }
+#endif
+    return 0;
+  }
+
+  /********************************************************************************************************************/
+
+#define FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(RawType, UserType)                                                         \
+  template size_t FixedPointConverter::vectorToCookedSimd<RawType, UserType>(                                          \
+      const RawType* raw, size_t n, UserType* cooked) const;                                                           \
+  template size_t FixedPointConverter::vectorToRawSimd<UserType, RawType>(                                             \
+      const UserType* cooked, size_t n, RawType* raw) const
+
+  FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(int16_t, int32_t);
+  FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(int16_t, float);
+  FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(int16_t, double);
+  FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(int32_t, int32_t);
+  FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(int32_t, float);
+  FIXEDPOINT_INSTANTIATE_SIMD_KERNELS(int32_t, double);
+
+#undef FIXEDPOINT_INSTANTIATE_SIMD_KERNELS
+
+} // namespace ChimeraTK
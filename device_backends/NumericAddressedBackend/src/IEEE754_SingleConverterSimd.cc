@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Vectorised conversion kernels of the IEEE754_SingleConverter, see SimdSupport.h.
+ *
+ * The kernels produce bit-identical results to the generic implementation. Widening float to double and converting
+ * int32 to float is exact resp. rounds like the static_cast in the generic implementation. Conversions which might
+ * overflow (float to int32, double to float) check each block of values first. If a block contains values out of range
+ * or NaN, it is passed to the generic implementation element by element, which limits resp. throws as before.
+ */
+
+#include "IEEE754_SingleConverter.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#  include <immintrin.h>
+#  define CHIMERATK_IEEE754_SIMD
+#endif
+
+namespace ChimeraTK {
+
+#ifdef CHIMERATK_IEEE754_SIMD
+
+  namespace {
+
+    /******************************************************************************************************************/
+
+    /// Convert element by element like the generic implementation, which throws for values out of range and NaN
+    void toInt32Generic(const int32_t* raw, size_t n, int32_t* cooked) {
+      for(size_t k = 0; k < n; ++k) {
+        float genericRepresentation;
+        memcpy(&genericRepresentation, raw + k, sizeof(float));
+        cooked[k] = RoundingRangeCheckingDataConverter<float, int32_t>::converter::convert(genericRepresentation);
+      }
+    }
+
+    /******************************************************************************************************************/
+    /* AVX2 implementation                                                                                            */
+    /******************************************************************************************************************/
+
+    __attribute__((target("avx2"))) size_t toDoubleAvx2(const int32_t* raw, size_t n, double* cooked) {
+      size_t i = 0;
+      for(; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(raw + i)));
+        _mm256_storeu_pd(cooked + i, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        _mm256_storeu_pd(cooked + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("avx2"))) size_t toInt32Avx2(const int32_t* raw, size_t n, int32_t* cooked) {
+      const __m256d half = _mm256_set1_pd(0.5);
+      const __m256d one = _mm256_set1_pd(1.);
+      const __m256d signBit = _mm256_set1_pd(-0.);
+      const __m256d lowest = _mm256_set1_pd(std::numeric_limits<int32_t>::min());
+      const __m256d highest = _mm256_set1_pd(std::numeric_limits<int32_t>::max());
+
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m256d d = _mm256_cvtps_pd(_mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i))));
+
+        // round half away from zero
+        __m256d r = _mm256_round_pd(d, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256d needsIncrement = _mm256_cmp_pd(_mm256_andnot_pd(signBit, _mm256_sub_pd(d, r)), half, _CMP_GE_OQ);
+        r = _mm256_add_pd(r, _mm256_and_pd(needsIncrement, _mm256_or_pd(_mm256_and_pd(d, signBit), one)));
+
+        __m256d isValid = _mm256_and_pd(_mm256_cmp_pd(r, lowest, _CMP_GE_OQ), _mm256_cmp_pd(r, highest, _CMP_LE_OQ));
+        if(_mm256_movemask_pd(isValid) != 0xF) {
+          toInt32Generic(raw + i, 4, cooked + i);
+          continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(cooked + i), _mm256_cvttpd_epi32(r));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("avx2"))) size_t fromDoubleAvx2(const double* cooked, size_t n, int32_t* raw) {
+      const __m256d signBit = _mm256_set1_pd(-0.);
+      const __m256d highest = _mm256_set1_pd(FLT_MAX);
+
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m256d d = _mm256_loadu_pd(cooked + i);
+        __m256d isValid = _mm256_cmp_pd(_mm256_andnot_pd(signBit, d), highest, _CMP_LE_OQ);
+        if(_mm256_movemask_pd(isValid) != 0xF) {
+          // let the generic implementation limit values out of range
+          for(size_t k = i; k < i + 4; ++k) {
+            raw[k] = static_cast<int32_t>(IEEE754_SingleConverter().toRaw(cooked[k]));
+          }
+          continue;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(raw + i), _mm_castps_si128(_mm256_cvtpd_ps(d)));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("avx2"))) size_t fromInt32Avx2(const int32_t* cooked, size_t n, int32_t* raw) {
+      size_t i = 0;
+      for(; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(cooked + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(raw + i), _mm256_castps_si256(v));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+    /* SSE4.1 implementation                                                                                          */
+    /******************************************************************************************************************/
+
+    __attribute__((target("sse4.1"))) size_t toDoubleSse41(const int32_t* raw, size_t n, double* cooked) {
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m128 v = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(raw + i)));
+        _mm_storeu_pd(cooked + i, _mm_cvtps_pd(v));
+        _mm_storeu_pd(cooked + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("sse4.1"))) size_t toInt32Sse41(const int32_t* raw, size_t n, int32_t* cooked) {
+      const __m128d half = _mm_set1_pd(0.5);
+      const __m128d one = _mm_set1_pd(1.);
+      const __m128d signBit = _mm_set1_pd(-0.);
+      const __m128d lowest = _mm_set1_pd(std::numeric_limits<int32_t>::min());
+      const __m128d highest = _mm_set1_pd(std::numeric_limits<int32_t>::max());
+
+      size_t i = 0;
+      for(; i + 2 <= n; i += 2) {
+        __m128d d = _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(raw + i))));
+
+        __m128d r = _mm_round_pd(d, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m128d needsIncrement = _mm_cmpge_pd(_mm_andnot_pd(signBit, _mm_sub_pd(d, r)), half);
+        r = _mm_add_pd(r, _mm_and_pd(needsIncrement, _mm_or_pd(_mm_and_pd(d, signBit), one)));
+
+        __m128d isValid = _mm_and_pd(_mm_cmpge_pd(r, lowest), _mm_cmple_pd(r, highest));
+        if(_mm_movemask_pd(isValid) != 0x3) {
+          toInt32Generic(raw + i, 2, cooked + i);
+          continue;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(cooked + i), _mm_cvttpd_epi32(r));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("sse4.1"))) size_t fromDoubleSse41(const double* cooked, size_t n, int32_t* raw) {
+      const __m128d signBit = _mm_set1_pd(-0.);
+      const __m128d highest = _mm_set1_pd(FLT_MAX);
+
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m128d lo = _mm_loadu_pd(cooked + i);
+        __m128d hi = _mm_loadu_pd(cooked + i + 2);
+        __m128d isValid = _mm_and_pd(
+            _mm_cmple_pd(_mm_andnot_pd(signBit, lo), highest), _mm_cmple_pd(_mm_andnot_pd(signBit, hi), highest));
+        if(_mm_movemask_pd(isValid) != 0x3) {
+          for(size_t k = i; k < i + 4; ++k) {
+            raw[k] = static_cast<int32_t>(IEEE754_SingleConverter().toRaw(cooked[k]));
+          }
+          continue;
+        }
+        __m128 v = _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(raw + i), _mm_castps_si128(v));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+    __attribute__((target("sse4.1"))) size_t fromInt32Sse41(const int32_t* cooked, size_t n, int32_t* raw) {
+      size_t i = 0;
+      for(; i + 4 <= n; i += 4) {
+        __m128 v = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(cooked + i)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(raw + i), _mm_castps_si128(v));
+      }
+      return i;
+    }
+
+    /******************************************************************************************************************/
+
+  } // namespace
+
+#endif // CHIMERATK_IEEE754_SIMD
+
+  /********************************************************************************************************************/
+
+  template<typename CookedType>
+  size_t IEEE754_SingleConverter::vectorToCookedSimd(
+      [[maybe_unused]] const int32_t* raw, [[maybe_unused]] size_t n, [[maybe_unused]] CookedType* cooked) {
+#ifdef CHIMERATK_IEEE754_SIMD
+    switch(detail::getSimdLevel()) {
+      case detail::SimdLevel::avx2:
+        if constexpr(std::is_same<CookedType, double>::value) return toDoubleAvx2(raw, n, cooked);
+        if constexpr(std::is_same<CookedType, int32_t>::value) return toInt32Avx2(raw, n, cooked);
+        break;
+      case detail::SimdLevel::sse41:
+        if constexpr(std::is_same<CookedType, double>::value) return toDoubleSse41(raw, n, cooked);
+        if constexpr(std::is_same<CookedType, int32_t>::value) return toInt32Sse41(raw, n, cooked);
+        break;
+      case detail::SimdLevel::none:
+        break;
+    }
+#endif
+    return 0;
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename CookedType>
+  size_t IEEE754_SingleConverter::vectorToRawSimd(
+      [[maybe_unused]] const CookedType* cooked, [[maybe_unused]] size_t n, [[maybe_unused]] int32_t* raw) {
+#ifdef CHIMERATK_IEEE754_SIMD
+    switch(detail::getSimdLevel()) {
+      case detail::SimdLevel::avx2:
+        if constexpr(std::is_same<CookedType, double>::value) return fromDoubleAvx2(cooked, n, raw);
+        if constexpr(std::is_same<CookedType, int32_t>::value) return fromInt32Avx2(cooked, n, raw);
+        break;
+      case detail::SimdLevel::sse41:
+        if constexpr(std::is_same<CookedType, double>::value) return fromDoubleSse41(cooked, n, raw);
+        if constexpr(std::is_same<CookedType, int32_t>::value) return fromInt32Sse41(cooked, n, raw);
+        break;
+      case detail::SimdLevel::none:
+        break;
+    }
+#endif
+    return 0;
+  }
+
+  /********************************************************************************************************************/
+
+  template size_t IEEE754_SingleConverter::vectorToCookedSimd<int32_t>(const int32_t* raw, size_t n, int32_t* cooked);
+  template size_t IEEE754_SingleConverter::vectorToCookedSimd<double>(const int32_t* raw, size_t n, double* cooked);
+  template size_t IEEE754_SingleConverter::vectorToRawSimd<int32_t>(const int32_t* cooked, size_t n, int32_t* raw);
+  template size_t IEEE754_SingleConverter::vectorToRawSimd<double>(const double* cooked, size_t n, int32_t* raw);
+
+} // namespace ChimeraTK
@@ -11,6 +11,7 @@
 #include "NumericAddressedBackendMuxedRegisterAccessor.h"
 #include "NumericAddressedBackendRegisterAccessor.h"
 #include "TriggerDistributor.h"
+#include "Utilities.h"
 #include <nlohmann/json.hpp>
 
 namespace ChimeraTK {
@@ -117,6 +118,19 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  void NumericAddressedBackend::readMultiple(std::vector<ReadRequest>& requests) {
+    for(auto& request : requests) {
+      try {
+        read(request.bar, request.address, request.data, request.sizeInBytes);
+      }
+      catch(ChimeraTK::runtime_error&) {
+        request.error = std::current_exception();
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
   // Default range of valid BARs
   bool NumericAddressedBackend::barIndexValid(uint64_t bar) {
     return bar <= 5 || bar == 13;
@@ -128,6 +142,13 @@ namespace ChimeraTK {
   boost::shared_ptr<NDRegisterAccessor<UserType>> NumericAddressedBackend::getRegisterAccessor_impl(
       const RegisterPath& registerPathName, size_t numberOfWords, size_t wordOffsetInRegister, AccessModeFlags flags) {
     if(flags.has(AccessMode::wait_for_new_data)) {
+      // The data of accessors with wait_for_new_data is delivered through a queue, it cannot be read into the user
+      // buffer directly.
+      if(flags.has(AccessMode::zero_copy)) {
+        throw ChimeraTK::logic_error("Register " + registerPathName +
+            ": AccessMode::zero_copy cannot be combined with AccessMode::wait_for_new_data.");
+      }
+
       // get the interrupt information from the map file
       auto registerInfo = _registerMap.getBackendRegister(registerPathName);
       if(!registerInfo.getSupportedAccessModes().has(AccessMode::wait_for_new_data)) {
@@ -142,7 +163,8 @@ namespace ChimeraTK {
           return boost::make_shared<TriggerDistributor>(shared_from_this(), &_interruptControllerHandlerFactory,
               std::vector<uint32_t>({registerInfo.interruptId.front()}), nullptr, domain);
         };
-        asyncDomain = boost::make_shared<AsyncDomainImpl<TriggerDistributor, std::nullptr_t>>(creatorFct);
+        asyncDomain =
+            boost::make_shared<AsyncDomainImpl<TriggerDistributor, std::nullptr_t>>(creatorFct, _asyncQueueConfig);
         *_asyncDomainImpls.at(registerInfo.interruptId.front()) = asyncDomain;
         auto& domainsContainer = dynamic_cast<AsyncDomainsContainer<uint32_t>&>(*_asyncDomainsContainer);
         domainsContainer.addAsyncDomain(registerInfo.interruptId.front(), asyncDomain);
@@ -272,13 +294,13 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  VersionNumber NumericAddressedBackend::dispatchInterrupt(uint32_t interruptNumber) {
+  VersionNumber NumericAddressedBackend::dispatchInterrupt(uint32_t interruptNumber, uint32_t nInterrupts) {
     // This function just makes sure that at() is used to access the _primaryInterruptDistributors map,
     // which guarantees that the map is not altered.
     auto asyncDomain = _asyncDomainImpls.at(interruptNumber)->lock();
 
     if(asyncDomain) {
-      return asyncDomain->distribute(nullptr);
+      return asyncDomain->distribute(nullptr, VersionNumber{nullptr}, nInterrupts);
     }
     return VersionNumber{nullptr};
   }
@@ -303,4 +325,16 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  void NumericAddressedBackend::applyCommonParameters(const std::map<std::string, std::string>& parameters) {
+    _rawBufferPolicy = detail::RawBufferPolicy::fromParameters(parameters);
+    _asyncQueueConfig = AsyncQueueConfig::fromParameters(parameters);
+
+    auto it = parameters.find("parallelConversion");
+    if(it != parameters.end()) {
+      _parallelConversionThreshold = Utilities::parseIntegerParameter("parallelConversion", it->second);
+    }
+  }
+
+  /********************************************************************************************************************/
+
 } // namespace ChimeraTK
@@ -3,7 +3,81 @@
 
 #include "NumericAddressedBackendMuxedRegisterAccessor.h"
 
+#include <cstring>
+
 namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  detail::MuxedTransposer::MuxedTransposer(
+      std::vector<size_t> channelOffsets, const std::vector<size_t>& channelWidths, size_t pitch)
+  : _channelOffsets(std::move(channelOffsets)), _pitch(pitch) {
+    assert(_channelOffsets.size() == channelWidths.size());
+
+    // check if all channels have the same width and are packed without gaps, in order of their offsets
+    size_t width = channelWidths.empty() ? 0 : channelWidths.front();
+    bool isPacked = !channelWidths.empty() && _pitch == width * channelWidths.size();
+    for(size_t i = 0; i < channelWidths.size() && isPacked; ++i) {
+      isPacked = channelWidths[i] == width && _channelOffsets[i] == i * width;
+    }
+    if(!isPacked) return;
+
+    if(width == 1) _kind = Kind::packed8;
+    if(width == 2) _kind = Kind::packed16;
+    if(width == 4) _kind = Kind::packed32;
+  }
+
+  /********************************************************************************************************************/
+
+  void detail::MuxedTransposer::transpose(const std::byte* raw, size_t nSamples, int32_t* target, size_t stride) const {
+    switch(_kind) {
+      case Kind::packed8:
+        transposePacked<uint8_t>(raw, nSamples, target, stride);
+        return;
+      case Kind::packed16:
+        transposePacked<uint16_t>(raw, nSamples, target, stride);
+        return;
+      case Kind::packed32:
+        transposePacked<int32_t>(raw, nSamples, target, stride);
+        return;
+      case Kind::generic:
+        transposeGeneric(raw, nSamples, target, stride);
+        return;
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  template<typename RAW_TYPE>
+  void detail::MuxedTransposer::transposePacked(
+      const std::byte* raw, size_t nSamples, int32_t* target, size_t stride) const {
+    // The raw data is read sequentially, the writes go to one sequential stream per channel.
+    size_t nChannels = _channelOffsets.size();
+    for(size_t k = 0; k < nSamples; ++k) {
+      const std::byte* sample = raw + k * _pitch;
+      for(size_t c = 0; c < nChannels; ++c) {
+        RAW_TYPE value;
+        std::memcpy(&value, sample + c * sizeof(RAW_TYPE), sizeof(RAW_TYPE));
+        target[c * stride + k] = static_cast<int32_t>(value);
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void detail::MuxedTransposer::transposeGeneric(
+      const std::byte* raw, size_t nSamples, int32_t* target, size_t stride) const {
+    size_t nChannels = _channelOffsets.size();
+    for(size_t k = 0; k < nSamples; ++k) {
+      const std::byte* sample = raw + k * _pitch;
+      for(size_t c = 0; c < nChannels; ++c) {
+        std::memcpy(target + c * stride + k, sample + _channelOffsets[c], sizeof(int32_t));
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
   INSTANTIATE_MULTI_TEMPLATE_FOR_CHIMERATK_USER_TYPES(
       NumericAddressedBackendMuxedRegisterAccessor, FixedPointConverter);
   INSTANTIATE_MULTI_TEMPLATE_FOR_CHIMERATK_USER_TYPES(
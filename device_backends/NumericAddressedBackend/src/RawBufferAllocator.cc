@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "RawBufferAllocator.h"
+
+#include "Exception.h"
+#include "Utilities.h"
+
+#include <sys/mman.h>
+
+#include <new>
+
+namespace ChimeraTK::detail {
+
+  /********************************************************************************************************************/
+
+  namespace {
+
+    /// Whether the buffer is allocated with mmap. This must only depend on the arguments, so the deallocation takes the
+    /// same path.
+    bool useHugePages(size_t sizeInBytes, const RawBufferPolicy& policy) {
+      return policy.hugePages && sizeInBytes >= RawBufferPolicy::hugePageSize;
+    }
+
+    /// Size of the mapping, which is rounded up to full huge pages (required by munmap for MAP_HUGETLB)
+    size_t mappingSize(size_t sizeInBytes) {
+      return (sizeInBytes + RawBufferPolicy::hugePageSize - 1) / RawBufferPolicy::hugePageSize *
+          RawBufferPolicy::hugePageSize;
+    }
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  RawBufferPolicy RawBufferPolicy::fromParameters(const std::map<std::string, std::string>& parameters) {
+    RawBufferPolicy policy;
+
+    auto it = parameters.find("bufferAlignment");
+    if(it != parameters.end()) {
+      policy.alignment = Utilities::parseIntegerParameter("bufferAlignment", it->second, 1, hugePageSize);
+      if((policy.alignment & (policy.alignment - 1)) != 0) {
+        throw ChimeraTK::logic_error("Parameter 'bufferAlignment' must be a power of two: '" + it->second + "'");
+      }
+    }
+
+    it = parameters.find("hugePages");
+    if(it != parameters.end()) {
+      if(it->second != "0" && it->second != "1") {
+        throw ChimeraTK::logic_error("Invalid value for parameter 'hugePages' (must be 0 or 1): '" + it->second + "'");
+      }
+      policy.hugePages = (it->second == "1");
+    }
+
+    return policy;
+  }
+
+  /********************************************************************************************************************/
+
+  void* allocateRawBuffer(size_t sizeInBytes, const RawBufferPolicy& policy) {
+    if(useHugePages(sizeInBytes, policy)) {
+      // mappings are always page aligned, which satisfies any sensible alignment
+      auto size = mappingSize(sizeInBytes);
+      void* buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if(buffer == MAP_FAILED) {
+        // no explicit huge pages reserved: fall back to transparent huge pages
+        buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(buffer == MAP_FAILED) throw std::bad_alloc();
+        madvise(buffer, size, MADV_HUGEPAGE); // only a hint, failure is not critical
+      }
+      return buffer;
+    }
+    return ::operator new(sizeInBytes, std::align_val_t(policy.alignment));
+  }
+
+  /********************************************************************************************************************/
+
+  void deallocateRawBuffer(void* buffer, size_t sizeInBytes, const RawBufferPolicy& policy) noexcept {
+    if(useHugePages(sizeInBytes, policy)) {
+      munmap(buffer, mappingSize(sizeInBytes));
+      return;
+    }
+    ::operator delete(buffer, std::align_val_t(policy.alignment));
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
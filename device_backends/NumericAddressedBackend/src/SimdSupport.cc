@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "SimdSupport.h"
+
+#include "Exception.h"
+
+#include <atomic>
+#include <string>
+
+namespace ChimeraTK::detail {
+
+  /********************************************************************************************************************/
+
+  namespace {
+    std::atomic<SimdLevel>& activeSimdLevel() {
+      static std::atomic<SimdLevel> level{getSupportedSimdLevel()};
+      return level;
+    }
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  SimdLevel getSimdLevel() {
+    return activeSimdLevel().load(std::memory_order_relaxed);
+  }
+
+  /********************************************************************************************************************/
+
+  SimdLevel getSupportedSimdLevel() {
+    static const SimdLevel level = [] {
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_cpu_init();
+      if(__builtin_cpu_supports("avx2")) return SimdLevel::avx2;
+      if(__builtin_cpu_supports("sse4.1")) return SimdLevel::sse41;
+#endif
+      return SimdLevel::none;
+    }();
+    return level;
+  }
+
+  /********************************************************************************************************************/
+
+  void setSimdLevelForTesting(SimdLevel level) {
+    if(level > getSupportedSimdLevel()) {
+      throw ChimeraTK::logic_error("SIMD level " + std::to_string(static_cast<int>(level)) +
+          " is not supported by the CPU, the highest supported level is " +
+          std::to_string(static_cast<int>(getSupportedSimdLevel())));
+    }
+    activeSimdLevel().store(level, std::memory_order_relaxed);
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
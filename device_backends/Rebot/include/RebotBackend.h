@@ -12,6 +12,7 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/thread.hpp>
 
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <iomanip>
@@ -45,19 +46,41 @@ namespace ChimeraTK {
    protected:
     std::string _boardAddr;
     std::string _port;
+    /// Maximum number of requests in flight (only used by protocol version 0, which splits large transfers)
+    size_t _pipelineDepth;
+    size_t _maximumMergeGap;
 
+    // One TCP connection to the server. Several sessions allow independent
+    // threads to access the device in parallel.
+    struct Session {
+      // Only access the following members when holding the mutex. They are
+      // also accessed by the heartbeat thread
+      std::mutex mutex;
+      boost::shared_ptr<Rebot::Connection> connection;
+      std::unique_ptr<RebotProtocolImplementor> protocolImplementor;
+      /// The time when the last command (read/write/heartbeat) was send
+      boost::chrono::steady_clock::time_point lastSendTime;
+    };
+
+    // Locking order: first the _threadInformerMutex, then the session mutexes
+    // in the order of the vector. read() and write() only hold a single session
+    // mutex.
     boost::shared_ptr<ThreadInformerMutex> _threadInformerMutex;
-    // Only access the following membergs when holding the mutex. They are
-    // also accessed by the heartbeat thread
-    boost::shared_ptr<Rebot::Connection> _connection;
-    std::unique_ptr<RebotProtocolImplementor> _protocolImplementor;
-    /// The time when the last command (read/write/heartbeat) was send
-    boost::chrono::steady_clock::time_point _lastSendTime;
+    // The vector itself is not modified after construction
+    std::vector<std::unique_ptr<Session>> _sessions;
+    // The session to wait for next if all sessions are busy
+    std::atomic<size_t> _nextSession{0};
     unsigned int _connectionTimeout;
 
+    // lock a session which is not in use, or wait for one if all are busy
+    Session& lockSession(std::unique_lock<std::mutex>& lock);
+    static std::vector<std::unique_ptr<Session>> makeSessions(
+        size_t nSessions, const std::string& boardAddr, const std::string& port, uint32_t connectionTimeout_sec);
+
    public:
     RebotBackend(std::string boardAddr, std::string port, const std::string& mapFileName = "",
-        uint32_t connectionTimeout_sec = DEFAULT_CONNECTION_TIMEOUT_sec);
+        uint32_t connectionTimeout_sec = DEFAULT_CONNECTION_TIMEOUT_sec, size_t pipelineDepth = 1,
+        size_t maximumMergeGap = 0, size_t nSessions = 1);
     ~RebotBackend() override;
     /// The function opens the connection to the device
     void open() override;
@@ -66,16 +89,32 @@ namespace ChimeraTK {
     void write(uint8_t bar, uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) override;
     std::string readDeviceInfo() override { return {"RebotDevice"}; }
 
+    /* Supported parameters are "ip", "port", "map", "timeout" (connection timeout in seconds), "pipelineDepth" (maximum
+     * number of requests sent before waiting for the responses, 1 to MAX_PIPELINE_DEPTH, default 1), "mergeGap"
+     * (maximum gap in bytes between two merged transfers, see NumericAddressedBackend::maximumMergeGap(), up to
+     * MAX_MERGE_GAP, default 0) and "sessions" (number of TCP connections to the server used by concurrent transfers,
+     * 1 to MAX_SESSIONS, default 1). Over high latency links, a merge gap lets a TransferGroup read registers close to
+     * each other with a single request. */
     static boost::shared_ptr<DeviceBackend> createInstance(
         std::string address, std::map<std::string, std::string> parameters);
 
     size_t minimumTransferAlignment([[maybe_unused]] uint64_t bar) const override { return 4; }
 
+    size_t maximumMergeGap([[maybe_unused]] uint64_t bar) const override { return _maximumMergeGap; }
+
    protected:
     void heartbeatLoop(const boost::shared_ptr<ThreadInformerMutex>& threadInformerMutex);
     boost::thread _heartbeatThread;
 
     const static uint32_t DEFAULT_CONNECTION_TIMEOUT_sec{5};
+
+    // Upper limits of the parameters "pipelineDepth" and "mergeGap". The requests of a full pipeline are sent in one
+    // write, and a merged transfer also transfers the gaps, so larger values only waste memory and bandwidth.
+    const static size_t MAX_PIPELINE_DEPTH{1024};
+    const static size_t MAX_MERGE_GAP{1024 * 1024};
+
+    // Upper limit of the parameter "sessions". Each session is a TCP connection which the server has to accept.
+    const static size_t MAX_SESSIONS{64};
   };
 
 } // namespace ChimeraTK
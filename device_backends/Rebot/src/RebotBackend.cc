@@ -7,22 +7,26 @@
 #include "RebotProtocol1.h"
 #include "RebotProtocolDefinitions.h"
 #include "testableRebotSleep.h"
+#include "Utilities.h"
 
 #include <boost/bind/bind.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <utility>
 
 namespace ChimeraTK {
 
-  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(boost::shared_ptr<Rebot::Connection>& c);
+  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(
+      boost::shared_ptr<Rebot::Connection>& c, size_t pipelineDepth);
   uint32_t getProtocolVersion(boost::shared_ptr<Rebot::Connection>& c);
   uint32_t parseRxServerHello(const std::vector<uint32_t>& serverHello);
 
-  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(boost::shared_ptr<Rebot::Connection>& c) {
+  std::unique_ptr<RebotProtocolImplementor> getProtocolImplementor(
+      boost::shared_ptr<Rebot::Connection>& c, size_t pipelineDepth) {
     auto serverVersion = getProtocolVersion(c);
     if(serverVersion == 0) {
-      return std::make_unique<RebotProtocol0>(c);
+      return std::make_unique<RebotProtocol0>(c, pipelineDepth);
     }
     if(serverVersion == 1) {
       return std::make_unique<RebotProtocol1>(c);
@@ -65,14 +69,31 @@ namespace ChimeraTK {
     return serverHello.at(2);
   }
 
-  RebotBackend::RebotBackend(
-      std::string boardAddr, std::string port, const std::string& mapFileName, uint32_t connectionTimeout_sec)
+  RebotBackend::RebotBackend(std::string boardAddr, std::string port, const std::string& mapFileName,
+      uint32_t connectionTimeout_sec, size_t pipelineDepth, size_t maximumMergeGap, size_t nSessions)
   : NumericAddressedBackend(mapFileName), _boardAddr(std::move(boardAddr)), _port(std::move(port)),
+    _pipelineDepth(pipelineDepth), _maximumMergeGap(maximumMergeGap),
     _threadInformerMutex(boost::make_shared<ThreadInformerMutex>()),
-    _connection(boost::make_shared<Rebot::Connection>(_boardAddr, _port, connectionTimeout_sec)),
-    _lastSendTime(testable_rebot_sleep::now()), _connectionTimeout(Rebot::DEFAULT_CONNECTION_TIMEOUT),
+    _sessions(makeSessions(nSessions, _boardAddr, _port, connectionTimeout_sec)),
+    _connectionTimeout(Rebot::DEFAULT_CONNECTION_TIMEOUT),
     _heartbeatThread([&]() { heartbeatLoop(_threadInformerMutex); }) {}
 
+  /********************************************************************************************************************/
+
+  std::vector<std::unique_ptr<RebotBackend::Session>> RebotBackend::makeSessions(
+      size_t nSessions, const std::string& boardAddr, const std::string& port, uint32_t connectionTimeout_sec) {
+    std::vector<std::unique_ptr<Session>> sessions;
+    for(size_t i = 0; i < nSessions; ++i) {
+      auto session = std::make_unique<Session>();
+      session->connection = boost::make_shared<Rebot::Connection>(boardAddr, port, connectionTimeout_sec);
+      session->lastSendTime = testable_rebot_sleep::now();
+      sessions.push_back(std::move(session));
+    }
+    return sessions;
+  }
+
+  /********************************************************************************************************************/
+
   RebotBackend::~RebotBackend() {
     try {
       { // extra scope for the lock guard
@@ -94,44 +115,66 @@ namespace ChimeraTK {
   void RebotBackend::open() {
     std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
 
-    _connection->open();
+    for(auto& session : _sessions) {
+      std::lock_guard<std::mutex> sessionLock(session->mutex);
+      session->connection->open();
 
-    _lastSendTime = testable_rebot_sleep::now();
-    _protocolImplementor = getProtocolImplementor(_connection);
+      session->lastSendTime = testable_rebot_sleep::now();
+      session->protocolImplementor = getProtocolImplementor(session->connection, _pipelineDepth);
+    }
 
     setOpenedAndClearException();
   }
 
+  RebotBackend::Session& RebotBackend::lockSession(std::unique_lock<std::mutex>& lock) {
+    for(auto& session : _sessions) {
+      std::unique_lock<std::mutex> sessionLock(session->mutex, std::try_to_lock);
+      if(sessionLock.owns_lock()) {
+        lock = std::move(sessionLock);
+        return *session;
+      }
+    }
+    // all sessions are busy: wait for them in turn
+    auto& session = *_sessions[_nextSession++ % _sessions.size()];
+    lock = std::unique_lock<std::mutex>(session.mutex);
+    return session;
+  }
+
   void RebotBackend::read(uint8_t /*bar*/, uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) {
-    std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
+    std::unique_lock<std::mutex> lock;
+    auto& session = lockSession(lock);
 
     if(!isOpen()) {
       throw ChimeraTK::logic_error("Device is closed");
     }
     checkActiveException();
 
-    _lastSendTime = testable_rebot_sleep::now();
-    _protocolImplementor->read(addressInBytes, data, sizeInBytes);
+    session.lastSendTime = testable_rebot_sleep::now();
+    session.protocolImplementor->read(addressInBytes, data, sizeInBytes);
   }
 
   void RebotBackend::write(uint8_t /*bar*/, uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) {
-    std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
+    std::unique_lock<std::mutex> lock;
+    auto& session = lockSession(lock);
 
     if(!isOpen()) {
       throw ChimeraTK::logic_error("Device is closed");
     }
     checkActiveException();
 
-    _lastSendTime = testable_rebot_sleep::now();
-    _protocolImplementor->write(addressInBytes, data, sizeInBytes);
+    session.lastSendTime = testable_rebot_sleep::now();
+    session.protocolImplementor->write(addressInBytes, data, sizeInBytes);
   }
 
   void RebotBackend::closeImpl() {
     std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
 
     _opened = false;
-    _connection->close();
-    _protocolImplementor.reset(nullptr);
+    for(auto& session : _sessions) {
+      std::lock_guard<std::mutex> sessionLock(session->mutex);
+      session->connection->close();
+      session->protocolImplementor.reset(nullptr);
+    }
   }
 
   // FIXME #11279 Implement API breaking changes from linter warnings
@@ -155,7 +198,27 @@ namespace ChimeraTK {
     if(it != parameters.end()) {
       timeout = static_cast<uint32_t>(std::stoul(it->second));
     }
-    return boost::shared_ptr<RebotBackend>(new RebotBackend(tmcbIP, portNumber, mapFileName, timeout));
+
+    size_t pipelineDepth = 1;
+    it = parameters.find("pipelineDepth");
+    if(it != parameters.end()) {
+      pipelineDepth = Utilities::parseIntegerParameter("pipelineDepth", it->second, 1, MAX_PIPELINE_DEPTH);
+    }
+
+    size_t maximumMergeGap = 0;
+    it = parameters.find("mergeGap");
+    if(it != parameters.end()) {
+      maximumMergeGap = Utilities::parseIntegerParameter("mergeGap", it->second, 0, MAX_MERGE_GAP);
+    }
+
+    size_t nSessions = 1;
+    it = parameters.find("sessions");
+    if(it != parameters.end()) {
+      nSessions = Utilities::parseIntegerParameter("sessions", it->second, 1, MAX_SESSIONS);
+    }
+
+    return boost::shared_ptr<RebotBackend>(
+        new RebotBackend(tmcbIP, portNumber, mapFileName, timeout, pipelineDepth, maximumMergeGap, nSessions));
   }
 
   void RebotBackend::heartbeatLoop(const boost::shared_ptr<ThreadInformerMutex>& threadInformerMutex) {
@@ -164,29 +227,35 @@ namespace ChimeraTK {
         // only send a heartbeat if the connection was inactive for half of the
         // timeout period
 
-        // We can only calculate this while holding the lock (because we need _lastSendTime), but we have to use
+        // We can only calculate this while holding the lock (because we need the last send time), but we have to use
         // it when not holding the lock because we are calling sleep. Hence we have to store the next wakekup time in a
         // variable.
-        boost::chrono::steady_clock::time_point wakeupTime;
+        boost::chrono::steady_clock::time_point wakeupTime = boost::chrono::steady_clock::time_point::max();
 
-        { // scope of the lock guard. We must hold it to safely access _lastSendTime, which we need in the if statement
+        { // scope of the lock guard
           std::lock_guard<std::mutex> lock(_threadInformerMutex->mutex);
-          if((testable_rebot_sleep::now() - _lastSendTime) > boost::chrono::milliseconds(_connectionTimeout / 2)) {
-            // To handle the race condition that the thread woke up while the
-            // desructor was holding the lock and closes the socket: Check the flag
-            // and quit if set
-            if(threadInformerMutex->quitThread) {
-              break;
-            }
-            // always update the last send time. Otherwise the sleep will be
-            // ineffective for a closed connection and go to 100 & CPU load
-            _lastSendTime = testable_rebot_sleep::now();
-            if(_protocolImplementor) {
-              _protocolImplementor->sendHeartbeat();
+          // To handle the race condition that the thread woke up while the
+          // desructor was holding the lock and closes the socket: Check the flag
+          // and quit if set
+          if(threadInformerMutex->quitThread) {
+            break;
+          }
+          for(auto& session : _sessions) {
+            // We must hold the session lock to safely access its lastSendTime, which we need in the if statement
+            std::lock_guard<std::mutex> sessionLock(session->mutex);
+            if((testable_rebot_sleep::now() - session->lastSendTime) >
+                boost::chrono::milliseconds(_connectionTimeout / 2)) {
+              // always update the last send time. Otherwise the sleep will be
+              // ineffective for a closed connection and go to 100 & CPU load
+              session->lastSendTime = testable_rebot_sleep::now();
+              if(session->protocolImplementor) {
+                session->protocolImplementor->sendHeartbeat();
+              }
             }
+            // Sleep until the first session has been idle for half of the connection timeout (plus 1 ms)
+            wakeupTime =
+                std::min(wakeupTime, session->lastSendTime + boost::chrono::milliseconds(_connectionTimeout / 2 + 1));
           }
-          // Sleep for half of the connection timeout (plus 1 ms)
-          wakeupTime = _lastSendTime + boost::chrono::milliseconds(_connectionTimeout / 2 + 1);
         } // scope of the lock guard
 
         // sleep without holding the lock.
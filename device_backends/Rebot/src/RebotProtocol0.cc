@@ -7,12 +7,14 @@
 #include "Exception.h"
 #include "RebotProtocolDefinitions.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace ChimeraTK {
   using namespace Rebot;
 
-  RebotProtocol0::RebotProtocol0(boost::shared_ptr<Connection>& tcpCommunicator) : _tcpCommunicator(tcpCommunicator) {}
+  RebotProtocol0::RebotProtocol0(boost::shared_ptr<Connection>& tcpCommunicator, size_t pipelineDepth)
+  : _tcpCommunicator(tcpCommunicator), _pipelineDepth(pipelineDepth) {}
 
   RebotProtocol0::RegisterInfo::RegisterInfo(uint32_t addressInBytes, uint32_t sizeInBytes) {
     if(sizeInBytes % 4 != 0) {
@@ -34,38 +36,83 @@ namespace ChimeraTK {
     RegisterInfo registerInfo(addressInBytes, sizeInBytes);
 
     // read implementation for protocol 0 : we are limited in the read size and
-    // have to do multiple calls to fetchFromRebotServer
-
-    size_t iterationsRequired = registerInfo.nWords / READ_BLOCK_SIZE;
-    size_t leftOverWords = registerInfo.nWords % READ_BLOCK_SIZE;
-
-    // read in till the last multiple of READ_BLOCK_SIZE
-    for(size_t count = 0; count < iterationsRequired; ++count) {
-      fetchFromRebotServer(
-          registerInfo.addressInWords + (count * READ_BLOCK_SIZE), READ_BLOCK_SIZE, data + (count * READ_BLOCK_SIZE));
+    // have to do multiple requests. Up to _pipelineDepth requests are sent before
+    // waiting for the responses, which arrive in the order of the requests.
+    size_t nBlocks = (registerInfo.nWords + READ_BLOCK_SIZE - 1) / READ_BLOCK_SIZE;
+    auto blockSize = [&](size_t block) {
+      return std::min<uint32_t>(READ_BLOCK_SIZE, registerInfo.nWords - block * READ_BLOCK_SIZE);
+    };
+
+    size_t nRequested = 0;
+    for(size_t nReceived = 0; nReceived < nBlocks; ++nReceived) {
+      // fill up the pipeline. All requests are sent with a single write.
+      std::vector<uint32_t> requests;
+      for(; nRequested < nBlocks && nRequested - nReceived < _pipelineDepth; ++nRequested) {
+        requests.insert(requests.end(),
+            {uint32_t(MULTI_WORD_READ), uint32_t(registerInfo.addressInWords + nRequested * READ_BLOCK_SIZE),
+                blockSize(nRequested)});
+      }
+      if(!requests.empty()) {
+        _tcpCommunicator->write(requests);
+      }
+
+      try {
+        receiveReadResponse(blockSize(nReceived), data + nReceived * READ_BLOCK_SIZE);
+      }
+      catch(ChimeraTK::runtime_error&) {
+        // Collect the responses to the requests still in flight, so the next transfer starts in sync with the server.
+        // The data is not used.
+        std::vector<int32_t> discarded(READ_BLOCK_SIZE);
+        for(++nReceived; nReceived < nRequested; ++nReceived) {
+          try {
+            receiveReadResponse(blockSize(nReceived), discarded.data());
+          }
+          catch(ChimeraTK::runtime_error&) {
+          }
+        }
+        throw;
+      }
     }
-    // read remaining from the last multiple of READ_BLOCK_SIZE
-    fetchFromRebotServer(registerInfo.addressInWords + (iterationsRequired * READ_BLOCK_SIZE), leftOverWords,
-        data + (iterationsRequired * READ_BLOCK_SIZE));
   }
 
   void RebotProtocol0::write(uint32_t addressInBytes, int32_t const* data, size_t sizeInBytes) {
     RegisterInfo registerInfo(addressInBytes, sizeInBytes);
 
-    // Implementation for protocol version 0: Only single word write possible
-    std::vector<uint32_t> packet(3);
-    for(unsigned int i = 0; i < registerInfo.nWords; ++i) {
-      packet[0] = SINGLE_WORD_WRITE;
-      packet[1] = registerInfo.addressInWords++;
-      packet[2] = static_cast<uint32_t>(data[i]);
-      _tcpCommunicator->write(packet);
-      _tcpCommunicator->read(1); // response is ignored for now
+    // Implementation for protocol version 0: Only single word write possible.
+    // Up to _pipelineDepth requests are sent with one write before collecting
+    // the responses. All responses are collected before failed words are
+    // reported, so the next transfer starts in sync with the server.
+    std::string failedWords;
+    for(uint32_t first = 0; first < registerInfo.nWords; first += _pipelineDepth) {
+      auto nRequests = static_cast<uint32_t>(std::min<size_t>(_pipelineDepth, registerInfo.nWords - first));
+      std::vector<uint32_t> requests;
+      requests.reserve(3 * nRequests);
+      for(uint32_t i = 0; i < nRequests; ++i) {
+        requests.insert(requests.end(),
+            {uint32_t(SINGLE_WORD_WRITE), registerInfo.addressInWords + first + i,
+                static_cast<uint32_t>(data[first + i])});
+      }
+      _tcpCommunicator->write(requests);
+
+      std::vector<uint32_t> responses = _tcpCommunicator->read(nRequests);
+      for(uint32_t i = 0; i < nRequests; ++i) {
+        if(responses[i] != uint32_t(Rebot::WRITE_ACK)) {
+          failedWords += " " + std::to_string(registerInfo.addressInWords + first + i) + " (response code " +
+              std::to_string(static_cast<int32_t>(responses[i])) + ")";
+        }
+      }
+    }
+    if(!failedWords.empty()) {
+      throw ChimeraTK::runtime_error("Writing via ReboT failed for word addresses" + failedWords);
     }
   }
 
   void RebotProtocol0::fetchFromRebotServer(uint32_t wordAddress, uint32_t numberOfWords, int32_t* dataLocation) const {
     sendRebotReadRequest(wordAddress, numberOfWords);
+    receiveReadResponse(numberOfWords, dataLocation);
+  }
 
+  void RebotProtocol0::receiveReadResponse(uint32_t numberOfWords, int32_t* dataLocation) const {
     // first check that the response starts with READ_ACK. If it is an error code
     // there might be just one word in the response.
     std::vector<uint32_t> responseCode = _tcpCommunicator->read(1);
@@ -14,7 +14,9 @@ namespace ChimeraTK {
   }
 
   struct RebotProtocol0 : RebotProtocolImplementor {
-    explicit RebotProtocol0(boost::shared_ptr<Rebot::Connection>& tcpCommunicator);
+    /** pipelineDepth is the maximum number of read or single word write requests sent to the server before waiting
+     *  for the responses. A value of 1 means that each request is answered before the next one is sent. */
+    explicit RebotProtocol0(boost::shared_ptr<Rebot::Connection>& tcpCommunicator, size_t pipelineDepth = 1);
     virtual ~RebotProtocol0(){};
 
     virtual void read(uint32_t addressInBytes, int32_t* data, size_t sizeInBytes) override;
@@ -31,7 +33,10 @@ namespace ChimeraTK {
 
     //  protected:
     boost::shared_ptr<Rebot::Connection> _tcpCommunicator;
+    size_t _pipelineDepth;
     void fetchFromRebotServer(uint32_t wordAddress, uint32_t numberOfWords, int32_t* dataLocation) const;
+    // receive the response to a MULTI_WORD_READ request which has already been sent
+    void receiveReadResponse(uint32_t numberOfWords, int32_t* dataLocation) const;
     void sendRebotReadRequest(const uint32_t wordAddress, const uint32_t wordsToRead) const;
     static void transferVectorToDataPtr(const std::vector<uint32_t>& source, int32_t* destination);
   };
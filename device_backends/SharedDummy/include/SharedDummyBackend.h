@@ -12,11 +12,11 @@
 #include <boost/interprocess/allocators/allocator.hpp>
 #include <boost/interprocess/containers/vector.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
-#include <boost/interprocess/sync/interprocess_semaphore.hpp>
 #include <boost/interprocess/sync/named_mutex.hpp>
 #include <boost/move/unique_ptr.hpp>
 #include <boost/unordered_set.hpp>
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <mutex>
@@ -75,6 +75,26 @@ namespace ChimeraTK {
     // Bar sizes
     std::map<uint64_t, size_t> _barSizesInBytes;
 
+    /**
+     * Sequence counters in shared memory for lock-free reads (seqlock). Writers are serialised by the interprocess
+     * mutex and make the counter of the bar odd while they modify the bar contents. Readers do not lock, but retry if
+     * the counter was odd or has changed while they were copying the data, so multi-word reads are consistent.
+     * Bars are mapped to the counters modulo the table size, which at worst causes unnecessary retries.
+     *
+     * A writer which terminates in the middle of a write (e.g. killed by a signal) leaves the counter odd. All reads of
+     * the affected bars (and of bars sharing the counter) then retry forever. The table is only reset by
+     * SharedMemoryManager::reInitMemory(), i.e. when the shared memory is re-initialised after all processes using it
+     * have terminated.
+     */
+    struct SeqLockTable {
+      static const size_t size = 64;
+      std::atomic<uint32_t> sequence[size]{};
+    };
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Atomics in shared memory must be lock free");
+
+    // Pointer into the shared memory
+    SeqLockTable* _seqLocks{nullptr};
+
     // Naming of bars as shared memory elements
     const char* SHARED_MEMORY_BAR_PREFIX = "BAR_";
 
@@ -169,105 +189,69 @@ namespace ChimeraTK {
 
     /****************** definitions for across-instance triggering ********/
 
-    // We are using the process id as an id of the semaphore which is to be triggered for the interrupt dispatcher
-    // thread. Since there is only one interrupt dispatcher thread per mapped shared memory region in a process, and
-    // the semaphore is set inside the shared memory, this means we can identify all semaphores per shared memory
-    // this way.
-    // However, this implies the restriction that you must not create more than one backend instance per shared memory
-    // region inside a process. E.g. if you wanted to write a test by tricking the backend factory into creating more
-    // than one backend instance for the same process and shared memory, you will have a problem.
-    using SemId = std::uint32_t;
-
-    /// entry per semaphore in shared memory
-    struct SemEntry {
-      SemEntry() = default;
-      boost::interprocess::interprocess_semaphore s{0};
-      SemId semId{};
-      bool used = false;
-    };
+    /// this limits the allowed number of different interrupt numbers
+    static const int maxInterruptEntries = 1000;
 
-    /// info about interrupt that can be placed in shm
-    /// The _contollerID is conceptually wrong at this place. It is not used any more.
-    /// We keep it and set it to 0 to have the shm compaitible with older versions.
-    struct InterruptEntry {
-      int _controllerId{0};
-      int _intNumber{};
-      std::uint32_t _counter = 0;
-      bool used = false;
-    };
+    /// Shm layout for lock-free interrupt signalling.
+    /// Each interrupt number has a counter, which triggerInterrupt() increments. Afterwards it increments the
+    /// wakeupSequence and wakes up the dispatcher threads of all processes, which wait on the wakeupSequence with a
+    /// futex and compare the counters to the last values they have seen. No mutex is involved.
+    struct ShmForInterrupts {
+      struct Entry {
+        /// interrupt number + 1, 0 if the entry is unused. Entries are never released.
+        std::atomic<uint32_t> key{0};
+        std::atomic<uint32_t> counter{0};
+      };
 
-    /// this limits the allowed number of different (controllerId, intNumber) pairs
-    static const int maxInterruptEntries = 1000;
+      ShmForInterrupts() = default;
+      ShmForInterrupts(const ShmForInterrupts&) = delete;
 
-    /// Shm layout for semaphore management
-    /// not thread safe
-    struct ShmForSems {
-      // In addition to the semaphores themselves, shm stores a vector of
-      // interrupt numbers and their current counts.
-      // Vector entries are not moved and marked as unused when no longer needed.
-      // We need
-      // - a find function which returns list of appropriate  semaphores to be triggered
-      //   current concept does not use interrupt number for that
-      // - add/remove functions to add/remove a semaphore
-      // - functions to update interrupt counts
-
-      using Sem = boost::interprocess::interprocess_semaphore;
-
-      ShmForSems() = default;
-      ShmForSems(const ShmForSems&) = delete;
-
-      /// find unsed semaphore, mark it as used and return pointer to it
-      Sem* addSem(SemId semId);
-      bool removeSem(SemId semId);
-      /// compare against PidSet and remove unused entries
-      void cleanup(PidSet* pidSet);
-
-      /// update shm entry to tell that interrupt is triggered
-      /// implementation: increase interrupt count of given interrupt
+      /// find the entry for the interrupt number, or add it if it does not exist yet
+      Entry& findOrAddEntry(uint32_t interruptNumber);
+
+      /// increase the count of the interrupt and wake up all dispatcher threads
       void addInterrupt(uint32_t interruptNumber);
 
-      /// find list of semaphores to be triggered for given interrupt info
-      /// if requested, update associated info
-      /// i.e. store interrupt number so it can be found by triggered process
-      std::list<Sem*> findSems(uint32_t interruptNumber = {}, bool update = false);
+      /// wake up all dispatcher threads
+      void wakeUp();
+
+      /// wait until the wakeupSequence differs from the given value (might also return spuriously)
+      void waitForWakeUp(uint32_t sequence);
 
       /// for debugging purposes
       void print();
 
-      SemEntry semEntries[SHARED_MEMORY_N_MAX_MEMBER];
-      InterruptEntry interruptEntries[maxInterruptEntries];
+      std::atomic<uint32_t> wakeupSequence{0};
+      /// number of dispatcher threads waiting, to avoid the system call if nobody waits
+      std::atomic<uint32_t> nWaiting{0};
+      /// Entries are placed at interruptNumber % maxInterruptEntries, or the next free place after it
+      Entry entries[maxInterruptEntries];
     };
 
     struct InterruptDispatcherThread;
 
     class InterruptDispatcherInterface {
      public:
-      /// adds semaphore & dispatcher thread on creation of interface
-      /// shm will contain semaphore array and is protected by shmMutex
+      /// finds or creates the interrupt entries in shm and starts the dispatcher thread
       /// <br>Since this object stores a reference to the backend it should be destroyed before the components
       /// of the backend required by the dispatcher thread
-      InterruptDispatcherInterface(SharedDummyBackend& backend, boost::interprocess::managed_shared_memory& shm,
-          boost::interprocess::named_mutex& shmMutex);
+      InterruptDispatcherInterface(SharedDummyBackend& backend, boost::interprocess::managed_shared_memory& shm);
 
-      /// stops dispatcher thread and removes semaphore
+      /// stops dispatcher thread
       ~InterruptDispatcherInterface();
       /// cleanup our objects in given shm. This is only needed when corrupt shm was detected which
       ///  needs re-initialization
-      /// If pidSet given, remove unmatching entries. Otherwise, remove whole object in shm
       static void cleanupShm(boost::interprocess::managed_shared_memory& shm);
-      static void cleanupShm(boost::interprocess::managed_shared_memory& shm, PidSet* pidSet);
 
       /// to be called from process which wishes to trigger some interrupt
       void triggerInterrupt(uint32_t intNumber);
-      boost::interprocess::named_mutex& _shmMutex;
-      SemId _semId;
-      ShmForSems* _semBuf;
+      ShmForInterrupts* _interruptShm;
       boost::movelib::unique_ptr<InterruptDispatcherThread> _dispatcherThread;
       SharedDummyBackend& _backend;
     };
 
     struct InterruptDispatcherThread {
-      /// starts dispatcher thread and then registers a semaphore of the semaphore array
+      /// takes the current interrupt counts as reference and starts the dispatcher thread
       explicit InterruptDispatcherThread(InterruptDispatcherInterface* dispatcherInterf);
       InterruptDispatcherThread(const InterruptDispatcherThread&) = delete;
       /// stops and removes thread
@@ -281,11 +265,10 @@ namespace ChimeraTK {
      private:
       // plain pointer, because of cyclic dependency
       InterruptDispatcherInterface* _dispatcherInterf;
-      SemId _semId;
-      ShmForSems* _semShm;
-      ShmForSems::Sem* _sem = nullptr;
+      ShmForInterrupts* _interruptShm;
+      /// last seen counter per interrupt number
+      std::map<uint32_t, uint32_t> _lastInterruptState;
       boost::thread _thr;
-      std::atomic_bool _started{false};
       std::atomic_bool _stop{false};
     };
   };
@@ -10,12 +10,17 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/lambda/lambda.hpp>
+#include <linux/futex.h>
+#include <sys/syscall.h>
 
 #include <algorithm>
 #include <cstring>
 #include <functional>
+#include <limits>
 #include <regex>
 #include <sstream>
+#include <thread>
+#include <unistd.h>
 
 namespace ChimeraTK {
 
@@ -33,6 +38,11 @@ namespace ChimeraTK {
 
   // Construct a segment for each bar and set required size
   void SharedDummyBackend::setupBarContents() {
+    {
+      std::lock_guard<boost::interprocess::named_mutex> lock(sharedMemoryManager.interprocessMutex);
+      _seqLocks = sharedMemoryManager.segment.find_or_construct<SeqLockTable>(boost::interprocess::unique_instance)();
+    }
+
     for(auto& _barSizesInByte : _barSizesInBytes) {
       std::string barName = SHARED_MEMORY_BAR_PREFIX + std::to_string(_barSizesInByte.first);
 
@@ -69,10 +79,30 @@ namespace ChimeraTK {
     checkActiveException();
     checkSizeIsMultipleOfWordSize(sizeInBytes);
     uint64_t wordBaseIndex = address / sizeof(int32_t);
+    size_t nWords = sizeInBytes / sizeof(int32_t);
+    if(nWords == 0) {
+      return;
+    }
 
-    std::lock_guard<boost::interprocess::named_mutex> lock(sharedMemoryManager.interprocessMutex);
-    for(uint64_t wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t); ++wordIndex) {
-      TRY_REGISTER_ACCESS(data[wordIndex] = _barContents[bar]->at(wordBaseIndex + wordIndex););
+    SharedMemoryVector* barContents{nullptr};
+    TRY_REGISTER_ACCESS(barContents = _barContents.at(bar); barContents->at(wordBaseIndex + nWords - 1););
+    auto& sequence = _seqLocks->sequence[bar % SeqLockTable::size];
+
+    // Lock-free read, see SeqLockTable. The words can be modified concurrently, hence they are loaded atomically.
+    while(true) {
+      auto sequenceBefore = sequence.load(std::memory_order_acquire);
+      if(sequenceBefore % 2 == 0) {
+        for(size_t wordIndex = 0; wordIndex < nWords; ++wordIndex) {
+          data[wordIndex] = __atomic_load_n(&(*barContents)[wordBaseIndex + wordIndex], __ATOMIC_RELAXED);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+          return;
+        }
+      }
+      // A write is in progress or has happened in between. If the writer has died during the write, this never ends
+      // (see SeqLockTable).
+      std::this_thread::yield();
     }
   }
 
@@ -83,12 +113,26 @@ namespace ChimeraTK {
     checkActiveException();
     checkSizeIsMultipleOfWordSize(sizeInBytes);
     uint64_t wordBaseIndex = address / sizeof(int32_t);
+    size_t nWords = sizeInBytes / sizeof(int32_t);
+    if(nWords == 0) {
+      return;
+    }
+
+    // Check the range before starting, so the sequence counter is never left odd
+    SharedMemoryVector* barContents{nullptr};
+    TRY_REGISTER_ACCESS(barContents = _barContents.at(bar); barContents->at(wordBaseIndex + nWords - 1););
+    auto& sequence = _seqLocks->sequence[bar % SeqLockTable::size];
 
     std::lock_guard<boost::interprocess::named_mutex> lock(sharedMemoryManager.interprocessMutex);
 
-    for(uint64_t wordIndex = 0; wordIndex < sizeInBytes / sizeof(int32_t); ++wordIndex) {
-      TRY_REGISTER_ACCESS(_barContents[bar]->at(wordBaseIndex + wordIndex) = data[wordIndex];);
+    // Make the counter odd while writing, see SeqLockTable
+    auto sequenceBefore = sequence.load(std::memory_order_relaxed);
+    sequence.store(sequenceBefore + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for(size_t wordIndex = 0; wordIndex < nWords; ++wordIndex) {
+      __atomic_store_n(&(*barContents)[wordBaseIndex + wordIndex], data[wordIndex], __ATOMIC_RELAXED);
     }
+    sequence.store(sequenceBefore + 2, std::memory_order_release);
   }
 
   std::string SharedDummyBackend::readDeviceInfo() {
@@ -122,7 +166,9 @@ namespace ChimeraTK {
     // dmap file is relative to the dmap file location. Converting the relative
     // mapFile path to an absolute path avoids issues when the dmap file is not
     // in the working directory of the application.
-    return returnInstance<SharedDummyBackend>(address, address, convertPathRelativeToDmapToAbs(mapFileName));
+    auto backend = returnInstance<SharedDummyBackend>(address, address, convertPathRelativeToDmapToAbs(mapFileName));
+    boost::static_pointer_cast<SharedDummyBackend>(backend)->applyCommonParameters(parameters);
+    return backend;
   }
 
   std::string SharedDummyBackend::convertPathRelativeToDmapToAbs(const std::string& mapfileName) {
@@ -144,65 +190,44 @@ namespace ChimeraTK {
     return {};
   }
 
-  SharedDummyBackend::InterruptDispatcherInterface::InterruptDispatcherInterface(SharedDummyBackend& backend,
-      boost::interprocess::managed_shared_memory& shm, boost::interprocess::named_mutex& shmMutex)
-  : _shmMutex(shmMutex), _backend(backend) {
-    // locking not needed, already defined as atomic
-    _semBuf = shm.find_or_construct<ShmForSems>(boost::interprocess::unique_instance)();
-    _semId = getOwnPID();
+  SharedDummyBackend::InterruptDispatcherInterface::InterruptDispatcherInterface(
+      SharedDummyBackend& backend, boost::interprocess::managed_shared_memory& shm)
+  : _backend(backend) {
+    // locking not needed, the segment manager is synchronised and the contents are atomic
+    _interruptShm = shm.find_or_construct<ShmForInterrupts>(boost::interprocess::unique_instance)();
 
     _dispatcherThread = boost::movelib::unique_ptr<InterruptDispatcherThread>(new InterruptDispatcherThread(this));
   }
 
   SharedDummyBackend::InterruptDispatcherInterface::~InterruptDispatcherInterface() {
-    // stop thread and remove semaphore on destruction
-    _dispatcherThread.reset(); // stops and deletes thread which uses semaphore
-    try {
-      // The scope of the try-block is the scope of the lock_guard, which can throw when locking.
-      // All the lines in the try-block have to be executed under the lock, although not everything
-      // might be throwing.
-
-      std::lock_guard<boost::interprocess::named_mutex> lock(_shmMutex);
-      _semBuf->removeSem(_semId);
-    }
-    catch(boost::interprocess::interprocess_exception&) {
-      // interprocess_exception is only thrown if something seriously went wrong.
-      // In this case we don't want anyone to catch it but terminate.
-      std::terminate();
-    }
+    // stop thread on destruction
+    _dispatcherThread.reset();
   }
 
   void SharedDummyBackend::InterruptDispatcherInterface::cleanupShm(boost::interprocess::managed_shared_memory& shm) {
-    shm.destroy<SharedMemoryVector>(boost::interprocess::unique_instance);
-  }
-  void SharedDummyBackend::InterruptDispatcherInterface::cleanupShm(
-      boost::interprocess::managed_shared_memory& shm, PidSet* pidSet) {
-    ShmForSems* semBuf = shm.find_or_construct<ShmForSems>(boost::interprocess::unique_instance)();
-    semBuf->cleanup(pidSet);
+    shm.destroy<ShmForInterrupts>(boost::interprocess::unique_instance);
   }
 
   void SharedDummyBackend::InterruptDispatcherInterface::triggerInterrupt(uint32_t intNumber) {
-    std::list<boost::interprocess::interprocess_semaphore*> semList;
-    {
-      std::lock_guard<boost::interprocess::named_mutex> lock(_shmMutex);
-      // find list of processes and their semaphores
-      // update interrupt info.
-      semList = _semBuf->findSems(intNumber, true);
-    }
-    // trigger the interrupts
-    for(auto* sem : semList) {
+    _interruptShm->addInterrupt(intNumber);
 #ifdef _DEBUG
-      std::cout << " InterruptDispatcherInterface::triggerInterrupt: post sem for interrupt: " << intNumber
-                << std::endl;
-      _semBuf->print();
+    std::cout << " InterruptDispatcherInterface::triggerInterrupt: woke up dispatchers for interrupt: " << intNumber
+              << std::endl;
+    _interruptShm->print();
 #endif
-      sem->post();
-    }
   }
 
   SharedDummyBackend::InterruptDispatcherThread::InterruptDispatcherThread(
       InterruptDispatcherInterface* dispatcherInterf)
-  : _dispatcherInterf(dispatcherInterf), _semId(dispatcherInterf->_semId), _semShm(dispatcherInterf->_semBuf) {
+  : _dispatcherInterf(dispatcherInterf), _interruptShm(dispatcherInterf->_interruptShm) {
+    // Take the current interrupt counts as reference before starting the thread. Interrupts triggered after the
+    // construction are dispatched by the thread, earlier ones are not. For entries added while this loop runs, all
+    // interrupts are dispatched (see run()).
+    for(auto& entry : _interruptShm->entries) {
+      auto key = entry.key.load(std::memory_order_acquire);
+      if(key == 0) continue;
+      _lastInterruptState[key - 1] = entry.counter.load(std::memory_order_acquire);
+    }
     _thr = boost::thread(&InterruptDispatcherThread::run, this);
   }
 
@@ -218,94 +243,44 @@ namespace ChimeraTK {
   }
 
   void SharedDummyBackend::InterruptDispatcherThread::run() {
-    // copy interrupt counts at the beginning, and then
-    // only look for different values. count up all values till they match
-    // map (controller,intNumber) -> count
-    // use map instead of vector because search is more efficient
-    std::map<std::pair<int, int>, std::uint32_t> lastInterruptState;
-    {
-      std::lock_guard<boost::interprocess::named_mutex> lock(_dispatcherInterf->_shmMutex);
-      for(auto& entry : _semShm->interruptEntries) {
-        assert(entry._controllerId == 0);
-        if(!entry.used) continue;
-        lastInterruptState[std::make_pair(entry._controllerId, entry._intNumber)] = entry._counter;
-      }
-      // we register a semaphore only after being ready
-      _sem = _semShm->addSem(_semId);
-      _started = true;
-    }
-
-    // local copy of shm contents, used to reduce lock time
-    InterruptEntry interruptEntries[maxInterruptEntries];
-
+    // compare the interrupt counts to the last seen values and
+    // count up all values till they match
     while(!_stop) {
-      _sem->wait();
-      {
-        std::lock_guard<boost::interprocess::named_mutex> lock(_dispatcherInterf->_shmMutex);
-        std::memcpy(interruptEntries, _semShm->interruptEntries, sizeof(interruptEntries));
-      }
-      for(auto& entry : interruptEntries) {
-        assert(entry._controllerId == 0);
-        if(!entry.used) continue;
-
-        // find match with controllerId and intNumber
-        auto key = std::make_pair(entry._controllerId, entry._intNumber);
-        auto it = lastInterruptState.find(key);
-        if(it != lastInterruptState.end()) {
-          while(it->second != entry._counter) {
-            // call trigger/dispatch
+      // Read the sequence before looking at the counters and at _stop. Interrupts and stop() change the sequence after
+      // updating the counter or _stop, so waitForWakeUp() returns immediately if they happen in between.
+      auto sequence = _interruptShm->wakeupSequence.load();
+
+      for(auto& entry : _interruptShm->entries) {
+        auto key = entry.key.load(std::memory_order_acquire);
+        if(key == 0) continue;
+        uint32_t interruptNumber = key - 1;
+        auto counter = entry.counter.load(std::memory_order_acquire);
+
+        // Entries which were not present when the dispatcher was constructed have been added afterwards, so all their
+        // interrupts are dispatched (the counter is still 0 while the entry is being added). Interrupts triggered while
+        // the dispatcher is being constructed may hence be dispatched as well.
+        auto& lastSeen = _lastInterruptState.try_emplace(interruptNumber, 0).first->second;
+        while(lastSeen != counter) {
+          // call trigger/dispatch
 #ifdef _DEBUG
-            std::cout << "existing interrupt event for x,y = " << entry._controllerId << ", " << entry._intNumber
-                      << std::endl;
+          std::cout << "interrupt event for " << interruptNumber << std::endl;
 #endif
-            handleInterrupt(entry._intNumber);
-            it->second++;
-          }
-        }
-        else {
-          // new interrupt number
-          // call trigger/dispatch count times
-#ifdef _DEBUG
-          std::cout << "count = " << entry._counter << " interrupt events for x,y = " << entry._controllerId << ", "
-                    << entry._intNumber << std::endl;
-#endif
-          handleInterrupt(entry._intNumber);
-          lastInterruptState[key] = entry._counter;
+          handleInterrupt(interruptNumber);
+          ++lastSeen;
         }
       }
+
+      if(_stop) {
+        break;
+      }
+      _interruptShm->waitForWakeUp(sequence);
     }
   }
 
   void SharedDummyBackend::InterruptDispatcherThread::stop() noexcept {
     _stop = true;
-    // we must wait until the semaphore is registered
-    try {
-      while(!_started) {
-        boost::this_thread::sleep_for(boost::chrono::milliseconds{10});
-      }
-    }
-    catch(const boost::thread_interrupted&) {
-      // Simply suppress the thread_interrupted here. This function is only called
-      // within a destructor, which anyway would have terminated the program when it sees the exception.
-      // There are two possible scenarios what can happen now.
-      // 1. _started is set and the destruction can continue normally.
-      // 2. _started is not set yet an we don't know if the semaphore is in the correct state.
-      //    Again there are two possibilities:
-      //    2a_ The semaphore was set correctly and the destructor continues normally.
-      //    2b_ sem->post() throws and terminate() is called (which otherwise would have been called from the escaping
-      //    thread_interrupted
-    }
-    catch(const boost::system::system_error&) {
-      // if something went really wrong we terminate here
-      std::terminate();
-    }
-
-    try {
-      _sem->post();
-    }
-    catch(const boost::interprocess::interprocess_exception&) {
-      std::terminate();
-    }
+    // This also wakes up the dispatcher threads of the other processes, which find nothing to do.
+    _interruptShm->wakeUp();
   }
 
   void SharedDummyBackend::InterruptDispatcherThread::handleInterrupt(uint32_t interruptNumber) {
@@ -319,103 +294,58 @@ namespace ChimeraTK {
     }
   }
 
-  SharedDummyBackend::ShmForSems::Sem* SharedDummyBackend::ShmForSems::addSem(SemId semId) {
-    // look up whether semaphore for id already exists and return error
-    for(auto& entry : semEntries) {
-      if(entry.used && entry.semId == semId) {
-        throw logic_error("error: semId already exists - check assumption about identifiers!");
-      }
+  namespace {
+    // The futex is not private to the process, so it works on shared memory mapped by several processes.
+    long futex(std::atomic<uint32_t>* address, int operation, uint32_t value) {
+      static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+      return syscall(SYS_futex, reinterpret_cast<uint32_t*>(address), operation, value, nullptr, nullptr, 0);
     }
+  } // namespace
 
-    for(auto& entry : semEntries) {
-      if(!entry.used) {
-        entry.semId = semId;
-        entry.used = true;
-        // It would be nice to also reset semaphores state, but if
-        // interrupt dispatcher thread which last used it terminated property its not necessary
-        // (since it calls post in destructor)
-        return &entry.s;
+  SharedDummyBackend::ShmForInterrupts::Entry& SharedDummyBackend::ShmForInterrupts::findOrAddEntry(
+      uint32_t interruptNumber) {
+    if(interruptNumber == std::numeric_limits<uint32_t>::max()) {
+      throw logic_error("Interrupt number " + std::to_string(interruptNumber) + " not supported by SharedDummyBackend");
+    }
+    uint32_t key = interruptNumber + 1;
+    for(size_t i = 0; i < maxInterruptEntries; ++i) {
+      auto& entry = entries[(interruptNumber + i) % maxInterruptEntries];
+      uint32_t existingKey = 0;
+      if(entry.key.compare_exchange_strong(existingKey, key) || existingKey == key) {
+        return entry;
       }
     }
     // increasing size not implemented
-    throw runtime_error("error: semaphore array full - increase maxSems!");
+    throw runtime_error("no place left in interruptEntries!");
   }
 
-  bool SharedDummyBackend::ShmForSems::removeSem(SemId semId) {
-    bool found = false;
-    for(auto& entry : semEntries) {
-      if(entry.used && entry.semId == semId) {
-        entry.used = false;
-        found = true;
-        break;
-      }
-    }
-    return found;
-  }
-  void SharedDummyBackend::ShmForSems::cleanup(PidSet* pidSet) {
-    for(auto& entry : semEntries) {
-      if(entry.used) {
-        if(std::find(std::begin(*pidSet), std::end(*pidSet), (int32_t)entry.semId) == std::end(*pidSet)) {
-          entry.used = false;
-        }
-      }
-    }
+  void SharedDummyBackend::ShmForInterrupts::addInterrupt(uint32_t interruptNumber) {
+    findOrAddEntry(interruptNumber).counter.fetch_add(1, std::memory_order_release);
+    wakeUp();
   }
 
-  void SharedDummyBackend::ShmForSems::addInterrupt(uint32_t interruptNumber) {
-    bool found = false;
-    for(auto& entry : interruptEntries) {
-      if(entry.used && entry._controllerId == 0 && static_cast<uint32_t>(entry._intNumber) == interruptNumber) {
-        entry._counter++;
-        found = true;
-        break;
-      }
-    }
-    if(!found) {
-      bool added = false;
-      for(auto& entry : interruptEntries) {
-        if(!entry.used) {
-          entry.used = true;
-          entry._controllerId = 0;
-          entry._intNumber = static_cast<int>(interruptNumber);
-          entry._counter = 1;
-          added = true;
-          break;
-        }
-      }
-      if(!added) {
-        throw runtime_error("no place left in interruptEntries!");
-      }
+  void SharedDummyBackend::ShmForInterrupts::wakeUp() {
+    ++wakeupSequence;
+    if(nWaiting > 0) {
+      futex(&wakeupSequence, FUTEX_WAKE, std::numeric_limits<int>::max());
     }
   }
 
-  std::list<SharedDummyBackend::ShmForSems::Sem*> SharedDummyBackend::ShmForSems::findSems(
-      uint32_t interruptNumber, bool update) {
-    std::list<Sem*> ret;
-    for(auto& entry : semEntries) {
-      if(entry.used) {
-        // we simply return all semaphores
-        ret.push_back(&entry.s);
-      }
-    }
-    if(update) addInterrupt(interruptNumber);
-    return ret;
+  void SharedDummyBackend::ShmForInterrupts::waitForWakeUp(uint32_t sequence) {
+    // Returns immediately if the sequence has already changed. The counterpart is the check of nWaiting in wakeUp():
+    // either the waker sees the increased nWaiting, or the futex sees the changed sequence.
+    ++nWaiting;
+    futex(&wakeupSequence, FUTEX_WAIT, sequence);
+    --nWaiting;
   }
 
-  void SharedDummyBackend::ShmForSems::print() {
+  void SharedDummyBackend::ShmForInterrupts::print() {
     std::cout << "shmem contents: " << std::endl;
-    int i = 0;
-    for(auto& entry : semEntries) {
-      if(entry.used) std::cout << "sem : " << entry.semId << std::endl;
-      i++;
-    }
-    i = 0;
-    for(auto& entry : interruptEntries) {
-      if(entry.used) {
-        std::cout << "interrupt : " << entry._controllerId << "," << entry._intNumber << " count = " << entry._counter
-                  << std::endl;
+    std::cout << "wake-up sequence : " << wakeupSequence << ", waiting : " << nWaiting << std::endl;
+    for(auto& entry : entries) {
+      if(entry.key != 0) {
+        std::cout << "interrupt : " << entry.key - 1 << " count = " << entry.counter << std::endl;
       }
-      i++;
     }
 
     std::cout << std::endl;
@@ -39,12 +39,11 @@ namespace ChimeraTK {
         std::string errMsg{"Maximum number of accessing members reached."};
         throw ChimeraTK::runtime_error(errMsg);
       }
-      InterruptDispatcherInterface::cleanupShm(segment, pidSet);
 
       pidSet->emplace_back(static_cast<int32_t>(getOwnPID()));
     }
     this->intDispatcherIf = boost::movelib::unique_ptr<InterruptDispatcherInterface>(
-        new InterruptDispatcherInterface(sharedDummyBackend, segment, interprocessMutex));
+        new InterruptDispatcherInterface(sharedDummyBackend, segment));
   }
 
   SharedDummyBackend::SharedMemoryManager::~SharedMemoryManager() {
@@ -99,7 +98,8 @@ namespace ChimeraTK {
     // Note: This uses _barSizeInBytes to determine number of vectors used,
     //       as it is initialized when this method gets called in the init list.
     return SHARED_MEMORY_OVERHEAD_PER_VECTOR * sharedDummyBackend._barSizesInBytes.size() +
-        SHARED_MEMORY_CONST_OVERHEAD + sharedDummyBackend.getTotalRegisterSizeInBytes() + sizeof(ShmForSems);
+        SHARED_MEMORY_CONST_OVERHEAD + sharedDummyBackend.getTotalRegisterSizeInBytes() + sizeof(ShmForInterrupts) +
+        sizeof(SeqLockTable);
   }
 
   std::pair<size_t, size_t> SharedDummyBackend::SharedMemoryManager::getInfoOnMemory() {
@@ -136,6 +136,9 @@ namespace ChimeraTK {
       }
     }
     InterruptDispatcherInterface::cleanupShm(segment);
+
+    // A writer of a terminated process might have left a sequence counter odd
+    segment.destroy<SeqLockTable>(boost::interprocess::unique_instance);
   }
 
   std::vector<std::string> SharedDummyBackend::SharedMemoryManager::listNamedElements() {
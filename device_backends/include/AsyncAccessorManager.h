@@ -102,6 +102,16 @@ namespace ChimeraTK {
 
     std::map<TransferElementID, std::unique_ptr<AsyncVariable>> _asyncVariables;
 
+    /**
+     * Flat list of all AsyncVariables owned by _asyncVariables. It is precomputed in updateSubscriberList() on each
+     * subscription and unsubscription, so distributing data and exceptions only iterates a contiguous array and
+     * neither traverses the map nor allocates memory. Like _asyncVariables it is protected by the domain lock.
+     */
+    std::vector<AsyncVariable*> _subscribers;
+
+    /** Rebuild _subscribers from _asyncVariables. Must be called whenever _asyncVariables has been changed. */
+    void updateSubscriberList();
+
     boost::shared_ptr<DeviceBackend> _backend;
     boost::shared_ptr<AsyncDomain> _asyncDomain;
 
@@ -246,6 +256,7 @@ namespace ChimeraTK {
     }
 
     _asyncVariables[newSubscriber->getId()] = std::move(untypedAsyncVariable);
+    updateSubscriberList();
     asyncVariableMapChanged(newSubscriber->getId());
 
     return newSubscriber;
@@ -262,12 +273,12 @@ namespace ChimeraTK {
 
     if(prepareIntermediateBuffers()) {
       assert(_delayedUnsubscriptions.empty());
-      for(auto& var : _asyncVariables) {
-        var.second->fillSendBuffer();
-        _isHoldingDomainLock = this;
-        var.second->send(); // function from  the AsyncVariable base class
-        _isHoldingDomainLock = nullptr;
+      _isHoldingDomainLock = this;
+      for(auto* var : _subscribers) {
+        var->fillSendBuffer();
+        var->send(); // function from  the AsyncVariable base class
       }
+      _isHoldingDomainLock = nullptr;
       for(auto id : _delayedUnsubscriptions) {
         unsubscribeImpl(id);
       }
@@ -2,9 +2,12 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "AsyncQueueConfig.h"
+
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <cstdint>
 #include <mutex>
 
 namespace ChimeraTK {
@@ -15,7 +18,8 @@ namespace ChimeraTK {
    * different threads. This class implements a central mutex such that only one operation on the distribution three is
    * executed at the same time.
    *
-   * This base class is providing the mutex and the _isActive flag, which is needed throughout the distribution tree.
+   * This base class is providing the mutex and the _isActive flag, which is needed throughout the distribution tree,
+   * as well as the AsyncQueueConfig for the accessors.
    * It also has a virtual setException() function to a allow sending exception from code that does not know
    * about the distributor type.
    *
@@ -24,23 +28,39 @@ namespace ChimeraTK {
    */
   class AsyncDomain : public boost::enable_shared_from_this<AsyncDomain> {
    public:
+    explicit AsyncDomain(AsyncQueueConfig queueConfig = {}) : _queueConfig(queueConfig) {}
     virtual void sendException(const std::exception_ptr& e) noexcept = 0;
     virtual ~AsyncDomain() = default;
 
     std::lock_guard<std::mutex> getDomainLock() { return std::lock_guard<std::mutex>{_mutex}; }
 
+    /** The configuration of the data transport queues of all accessors in this domain. It is constant, so it can be
+     *  read without holding the lock. */
+    const AsyncQueueConfig& getQueueConfig() const { return _queueConfig; }
+
    protected:
+    const AsyncQueueConfig _queueConfig;
+
     // This mutex is protecting all members and all functions in AsyncDomain and AsyncDomainImpl
     std::mutex _mutex;
     bool _isActive{false};
 
+    // Number of interrupts which have been merged into the data currently distributed, see AsyncDomainImpl::distribute
+    uint32_t _nCoalescedInterrupts{0};
+
     /**
      * Friend classes are allowed to read the _isActiveFlag without acquiring the mutex.
      * The friend's functions are only called from the AsyncDomain functions after already locking the mutex.
      */
     bool unsafeGetIsActive() const { return _isActive; }
 
-    // The friend functions are only allowed to call unsafeGetIsActive(). They must not touch any of the
+    /**
+     * Like unsafeGetIsActive(), friend classes can read the number of coalesced interrupts of the data which is
+     * currently distributed.
+     */
+    uint32_t unsafeGetNumberOfCoalescedInterrupts() const { return _nCoalescedInterrupts; }
+
+    // The friend functions are only allowed to call the unsafeGet functions. They must not touch any of the
     // internal variables directly.
     friend class AsyncAccessorManager;
     friend class TriggeredPollDistributor;
@@ -14,8 +14,9 @@ namespace ChimeraTK {
   class AsyncDomainImpl : public AsyncDomain {
    public:
     explicit AsyncDomainImpl(
-        std::function<boost::shared_ptr<DistributorType>(boost::shared_ptr<AsyncDomain>)> creatorFunction)
-    : _creatorFunction(creatorFunction) {}
+        std::function<boost::shared_ptr<DistributorType>(boost::shared_ptr<AsyncDomain>)> creatorFunction,
+        AsyncQueueConfig queueConfig = {})
+    : AsyncDomain(queueConfig), _creatorFunction(creatorFunction) {}
 
     /**
      * Distribute the data via the associated distribution tree.
@@ -31,9 +32,15 @@ namespace ChimeraTK {
      * In case distribute is called after activate, with a version number older than the polled initial value, the data
      * is dropped and not distributed. The return value is VersionNumber{nullptr}.
      *
+     * If the backend has merged several interrupts into one distribution (e.g. because the hardware counts interrupts
+     * which arrived while the previous one was handled), it passes their number as nCoalescedInterrupts. The number is
+     * handed to each AsyncNDRegisterAccessor together with the data, see
+     * AsyncNDRegisterAccessor::getNumberOfCoalescedInterrupts().
+     *
      * @ return The version number that has been used for distribution, or VersionNumber{nullptr} if there was no distribution.
      */
-    VersionNumber distribute(BackendDataType data, VersionNumber version = VersionNumber{nullptr});
+    VersionNumber distribute(
+        BackendDataType data, VersionNumber version = VersionNumber{nullptr}, uint32_t nCoalescedInterrupts = 1);
 
     /**
      * Activate and distribute the initial value.
@@ -42,7 +49,8 @@ namespace ChimeraTK {
      * the version as an argument. Otherwise a new version is created under the domain lock.
      *
      * In case distribute has been called before with a version number newer than the version of the polled initial
-     * value, these data and version number are distributed instead.
+     * value, these data and version number are distributed instead. The initial value is distributed with 0 coalesced
+     * interrupts, the stored data with the number of interrupts given to distribute.
      *
      *  @ return The version number that has been used for distribution.
      */
@@ -63,6 +71,7 @@ namespace ChimeraTK {
     // Data to resolve a race condition (see distribute and activate)
     BackendDataType _notDistributedData;
     VersionNumber _notDistributedVersion{nullptr};
+    uint32_t _notDistributedNCoalescedInterrupts{0};
     VersionNumber _activationVersion{nullptr};
   };
 
@@ -70,7 +79,7 @@ namespace ChimeraTK {
 
   template<typename DistributorType, typename BackendDataType>
   VersionNumber AsyncDomainImpl<DistributorType, BackendDataType>::distribute(
-      BackendDataType data, VersionNumber version) {
+      BackendDataType data, VersionNumber version, uint32_t nCoalescedInterrupts) {
     std::lock_guard l(_mutex);
     // everything incl. potential creation of a new version number must happen under the lock
     if(version == VersionNumber(nullptr)) {
@@ -81,6 +90,7 @@ namespace ChimeraTK {
       // Store the data. We might need it later if the data in activate is older due to a race condition.
       _notDistributedData = data;
       _notDistributedVersion = version;
+      _notDistributedNCoalescedInterrupts = nCoalescedInterrupts;
       return VersionNumber{nullptr};
     }
 
@@ -93,6 +103,7 @@ namespace ChimeraTK {
       return VersionNumber{nullptr};
     }
 
+    _nCoalescedInterrupts = nCoalescedInterrupts;
     distributor->distribute(data, version);
     return version;
   }
@@ -116,11 +127,13 @@ namespace ChimeraTK {
     }
 
     if(version >= _notDistributedVersion) {
+      _nCoalescedInterrupts = 0;
       distributor->activate(data, version);
       _activationVersion = version;
     }
     else {
       // Due to a race condition, it has been tried to distribute newer data before activate was called.
+      _nCoalescedInterrupts = _notDistributedNCoalescedInterrupts;
       distributor->activate(_notDistributedData, _notDistributedVersion);
       _activationVersion = _notDistributedVersion;
     }
@@ -170,6 +183,8 @@ namespace ChimeraTK {
       _distributor = distributor;
     }
 
+    // The initial value sent to the new accessor (if the domain is active) is not caused by an interrupt
+    _nCoalescedInterrupts = 0;
     return distributor->template subscribe<UserDataType>(name, numberOfWords, wordOffsetInRegister, flags);
   }
 
@@ -9,6 +9,8 @@
 #include <ChimeraTK/cppext/finally.hpp>
 #include <ChimeraTK/cppext/future_queue.hpp>
 
+#include <atomic>
+
 namespace ChimeraTK {
 
   class AsyncAccessorManager;
@@ -18,11 +20,15 @@ namespace ChimeraTK {
    *  receive the content of the buffer_2D, the version number and the data validity flag.
    *  The implementation is complete. The interrupt handling thread in the backend implementation
    *  can write to the queues through the member functions.
+   *
+   *  The length of the queue and the behaviour when it is full are taken from the AsyncQueueConfig of the AsyncDomain.
+   *
+   *  The queue is operated with SWAP_DATA and all its buffers are allocated in the constructor. Buffers are only
+   *  swapped between the sending AsyncVariable, the queue and the receiving side, so they form a ring of recycled
+   *  buffers and sending does not allocate memory once the accessor has been constructed.
    */
   template<typename UserType>
   class AsyncNDRegisterAccessor : public NDRegisterAccessor<UserType> {
-    static constexpr size_t _queueSize{3};
-
    public:
     /** In addition to the arguments of the NDRegisterAccessor constructor, you need
      *  an AsyncAccessorManager where you can unsubscribe. As the AsyncAccessorManager is
@@ -42,9 +48,21 @@ namespace ChimeraTK {
 
     /** You can only send destructively. If you want to keep a copy you have to make one yourself.
      *  This is more efficient that having one extra buffer within each AsyncNDRegisterAccessor.
+     *
+     *  After the call, data contains a recycled buffer of the correct size (or still the original data if it has not
+     *  been sent), so it can be filled again without allocation.
      */
     void sendDestructively(typename NDRegisterAccessor<UserType>::Buffer& data);
 
+    /** Return the number of values which have been lost so far because the queue was full (see AsyncQueueConfig).
+     *  Can be called from any thread. */
+    [[nodiscard]] size_t getNumberOfOverflows() const { return _nOverflows; }
+
+    /** Return the number of interrupts which the backend has merged into the value in the user buffer (see
+     *  AsyncDomainImpl::distribute()). Backends which do not coalesce interrupts report 1 for each value. The initial
+     *  value reports 0. Like the version number, this is updated by the read operations. */
+    [[nodiscard]] uint32_t getNumberOfCoalescedInterrupts() const { return _nCoalescedInterrupts; }
+
     ////////////////////////////////////////////////////
     // implementation of inherited, virtual functions //
     ////////////////////////////////////////////////////
@@ -102,9 +120,26 @@ namespace ChimeraTK {
     boost::shared_ptr<AsyncDomain> _asyncDomain;
     using typename NDRegisterAccessor<UserType>::Buffer;
     using NDRegisterAccessor<UserType>::buffer_2D;
-    Buffer _receiveBuffer;
 
-    cppext::future_queue<Buffer, cppext::SWAP_DATA> _dataTransportQueue{_queueSize};
+    /** Entry of the data transport queue. The number of coalesced interrupts is stored next to each value, so the
+     *  queue keeps it in step with the values: it is added on a push, replaced together with the value on an overwrite
+     *  and discarded together with a dropped value. */
+    struct QueueEntry {
+      Buffer buffer;
+      uint32_t nCoalescedInterrupts{0};
+    };
+
+    QueueEntry _receiveEntry;
+    // Entry for the sending side, only accessed while the AsyncDomain is locked
+    QueueEntry _sendEntry;
+    uint32_t _nCoalescedInterrupts{0};
+    // Shape of the buffers in the queue. Cannot be taken from the buffer_2D, which belongs to the receiving thread.
+    size_t _nChannels;
+    size_t _nElements;
+    AsyncQueueConfig _queueConfig;
+    std::atomic<size_t> _nOverflows{0};
+
+    cppext::future_queue<QueueEntry, cppext::SWAP_DATA> _dataTransportQueue{_queueConfig.length};
   };
 
   /********************************************************************************************************************/
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace ChimeraTK {
+
+  /**
+   *  Configuration of the data transport queue of the AsyncNDRegisterAccessor, i.e. how many values can be buffered
+   *  for a subscriber which is not reading fast enough, and what happens if the queue is full.
+   *
+   *  The configuration is held by the AsyncDomain and applies to all accessors subscribed to it.
+   */
+  struct AsyncQueueConfig {
+    /** Behaviour when a new value is sent to a full queue */
+    enum class OverflowPolicy {
+      /// Replace the last value in the queue with the new one, so the latest value is always delivered (default)
+      overwriteLast,
+      /// Discard the new value, so the queue keeps the values which arrived first
+      dropNewest
+    };
+
+    /** Number of values the queue can hold */
+    size_t length{3};
+
+    /** Maximum accepted value for length. All buffers of the queue are allocated when an accessor is created. */
+    static constexpr size_t maxLength{1U << 16U};
+
+    OverflowPolicy policy{OverflowPolicy::overwriteLast};
+
+    /**
+     *  Create the configuration from the CDD parameters "asyncQueueLength" (1 to maxLength) and "asyncOverflowPolicy"
+     *  ("overwriteLast" or "dropNewest"). Missing parameters keep the default. Throws ChimeraTK::logic_error for invalid
+     *  values.
+     */
+    static AsyncQueueConfig fromParameters(const std::map<std::string, std::string>& parameters);
+  };
+
+} // namespace ChimeraTK
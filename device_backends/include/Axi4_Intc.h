@@ -2,14 +2,29 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 #include "InterruptControllerHandler.h"
+#include "NDRegisterAccessor.h"
+#include "RegisterPath.h"
 
 namespace ChimeraTK {
 
+  /**
+   *  Handler for the Xilinx AXI4 interrupt controller (AXI INTC).
+   *
+   *  The description in the map file is a JSON object with the register path of the controller and an optional list of
+   *  options, e.g.
+   *
+   *    @![3] {"AXI4_INTC":{"path":"APP.INTC", "options":["IPR"]}}
+   *
+   *  The controller's registers ISR (or IPR if the option "IPR" is given) and IAR must be in the map file below the
+   *  path. In each handle() call the pending interrupts are read from the ISR or IPR, all of them are acknowledged with
+   *  a single write to the IAR, and only the distributors of the pending interrupts are triggered. Pending interrupts
+   *  without subscribers are acknowledged but otherwise ignored.
+   */
   class Axi4_Intc : public InterruptControllerHandler {
    public:
     explicit Axi4_Intc(InterruptControllerHandlerFactory* controllerHandlerFactory,
-        std::vector<uint32_t> const& controllerID, boost::shared_ptr<TriggerDistributor> parent)
-    : InterruptControllerHandler(controllerHandlerFactory, controllerID, std::move(parent)) {}
+        std::vector<uint32_t> const& controllerID, boost::shared_ptr<TriggerDistributor> parent,
+        RegisterPath const& path, bool usePendingRegister);
     ~Axi4_Intc() override = default;
 
     void handle(VersionNumber version) override;
@@ -17,6 +32,12 @@ namespace ChimeraTK {
     static std::unique_ptr<Axi4_Intc> create(InterruptControllerHandlerFactory*,
         std::vector<uint32_t> const& controllerID, std::string const& desrciption,
         boost::shared_ptr<TriggerDistributor> parent);
+
+   protected:
+    /** ISR or IPR, depending on the options */
+    boost::shared_ptr<NDRegisterAccessor<uint32_t>> _pendingInterrupts;
+    boost::shared_ptr<NDRegisterAccessor<uint32_t>> _acknowledge;
+    RegisterPath _path;
   };
 
 } // namespace ChimeraTK
@@ -5,14 +5,18 @@
 #include "AsyncDomainsContainerBase.h"
 #include "DeviceBackend.h"
 #include "Exception.h"
+#include "TransferStatistics.h"
 #include <condition_variable>
 #include <shared_mutex>
 
 #include <ChimeraTK/cppext/finally.hpp>
 
+#include <boost/make_shared.hpp>
+
 #include <atomic>
 #include <list>
 #include <mutex>
+#include <type_traits>
 
 namespace ChimeraTK {
 
@@ -52,6 +56,34 @@ namespace ChimeraTK {
 
     std::string getActiveExceptionMessage() noexcept;
 
+    /**
+     *  Enable recording of TransferStatistics. All register accessors passed to attachTransferStatistics() after this
+     *  call (i.e. all accessors obtained through a Device) record their transfers in their own TransferStatistics (see
+     *  TransferElement::getTransferStatistics()), which are in addition aggregated in the statistics of this backend
+     *  (see getTransferStatistics()). Accessors obtained before this call are not affected.
+     *
+     *  This function must not be called concurrently with getRegisterAccessor(). Calling it again has no effect.
+     */
+    void enableTransferStatistics() {
+      if(!_transferStatistics) _transferStatistics = boost::make_shared<TransferStatistics>();
+    }
+
+    /**
+     *  Return the statistics aggregated over all register accessors of this backend, or a nullptr if
+     *  enableTransferStatistics() has not been called.
+     */
+    [[nodiscard]] boost::shared_ptr<TransferStatistics> getTransferStatistics() const { return _transferStatistics; }
+
+    /**
+     *  Attach TransferStatistics to the given accessor, if enableTransferStatistics() has been called, and return the
+     *  accessor. This is done by the Device for the accessors handed out to the user only. Accessors used internally
+     *  (e.g. by other backends or for the distribution of asynchronous data) are not instrumented, so each transfer of
+     *  the user is counted only once in the statistics of the backend.
+     */
+    template<typename UserType>
+    boost::shared_ptr<NDRegisterAccessor<UserType>> attachTransferStatistics(
+        const boost::shared_ptr<NDRegisterAccessor<UserType>>& accessor);
+
    protected:
     /** Backends should call this function at the end of a (successful) open() call.*/
     void setOpenedAndClearException() noexcept;
@@ -77,6 +109,9 @@ namespace ChimeraTK {
 
     /** mutex to protect access to _activeExceptionMessage */
     std::mutex _mx_activeExceptionMessage;
+
+    /** statistics aggregated over all instrumented accessors, see enableTransferStatistics(). A nullptr if disabled. */
+    boost::shared_ptr<TransferStatistics> _transferStatistics;
   };
 
   /********************************************************************************************************************/
@@ -100,4 +135,20 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  template<typename UserType>
+  boost::shared_ptr<NDRegisterAccessor<UserType>> DeviceBackendImpl::attachTransferStatistics(
+      const boost::shared_ptr<NDRegisterAccessor<UserType>>& accessor) {
+    if(_transferStatistics) {
+      // strings have no fixed size and void registers carry no data, so only the number of transfers is counted
+      size_t bytesPerTransfer = 0;
+      if constexpr(!std::is_same<UserType, std::string>::value && !std::is_same<UserType, Void>::value) {
+        bytesPerTransfer = size_t(accessor->getNumberOfChannels()) * accessor->getNumberOfSamples() * sizeof(UserType);
+      }
+      accessor->setTransferStatistics(boost::make_shared<TransferStatistics>(bytesPerTransfer, _transferStatistics));
+    }
+    return accessor;
+  }
+
+  /********************************************************************************************************************/
+
 } // namespace ChimeraTK
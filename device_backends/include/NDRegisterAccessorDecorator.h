@@ -166,6 +166,11 @@ namespace ChimeraTK {
       return result;
     }
 
+    std::pair<std::string, uint64_t> getReplacementKey() const override {
+      // use the position of the target, so e.g. decorated slices of the same register are distinguished
+      return {this->_name, _target->getReplacementKey().second};
+    }
+
     void setPersistentDataStorage(boost::shared_ptr<ChimeraTK::PersistentDataStorage> storage) override {
       _target->setPersistentDataStorage(storage);
     }
@@ -6,6 +6,7 @@
 #include "DeviceBackend.h"
 #include "Exception.h"
 #include "TransferElementID.h"
+#include "TransferStatistics.h"
 #include "VersionNumber.h"
 
 #include <ChimeraTK/cppext/future_queue.hpp>
@@ -17,9 +18,11 @@
 #include <boost/thread.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <string>
 #include <typeinfo>
 #include <utility>
@@ -321,6 +324,16 @@ namespace ChimeraTK {
       }
     }
 
+    // helper function for readTransfer() without the statistics
+    void readTransferImpl() {
+      if(_accessModeFlags.has(AccessMode::wait_for_new_data)) {
+        readTransferAsyncWaitingImpl();
+      }
+      else {
+        doReadTransferSynchronously();
+      }
+    }
+
     // helper function that just gets rid of the DiscardValueException and otherwise does a pop_wait on the _readQueue.
     // It does not deal with other exceptions. This is done in handleTransferException.
     void readTransferAsyncWaitingImpl() {
@@ -344,12 +357,13 @@ namespace ChimeraTK {
      *  runtime_error exceptions thrown in the transfer are caught and rethrown in postRead().
      */
     void readTransfer() {
-      if(_accessModeFlags.has(AccessMode::wait_for_new_data)) {
-        readTransferAsyncWaitingImpl();
-      }
-      else {
-        doReadTransferSynchronously();
+      if(_transferStatistics) {
+        auto start = std::chrono::steady_clock::now();
+        readTransferImpl();
+        _transferStatistics->recordRead(std::chrono::steady_clock::now() - start);
+        return;
       }
+      readTransferImpl();
     }
 
    protected:
@@ -391,6 +405,20 @@ namespace ChimeraTK {
      * the backend. runtime_error exceptions thrown in the transfer are caught and rethrown in postRead().
      */
     bool readTransferNonBlocking() {
+      if(_transferStatistics) {
+        auto start = std::chrono::steady_clock::now();
+        bool hasNewData = readTransferNonBlockingImpl();
+        if(hasNewData) {
+          _transferStatistics->recordRead(std::chrono::steady_clock::now() - start);
+        }
+        return hasNewData;
+      }
+      return readTransferNonBlockingImpl();
+    }
+
+   private:
+    // helper function for readTransferNonBlocking() without the statistics
+    bool readTransferNonBlockingImpl() {
       if(_accessModeFlags.has(AccessMode::wait_for_new_data)) {
         return readTransferAsyncNonWaitingImpl();
       }
@@ -398,7 +426,6 @@ namespace ChimeraTK {
       return true;
     }
 
-   private:
     /** Helper function to catch the exceptions. Avoids code duplication.*/
     void preReadAndHandleExceptions(TransferType type) noexcept {
       try {
@@ -598,7 +625,15 @@ namespace ChimeraTK {
      *  This function internally calls doWriteTransfer(), which is implemented by the backend. runtime_error exceptions
      *  thrown in doWriteTransfer() are caught and rethrown in postWrite().
      */
-    bool writeTransfer(ChimeraTK::VersionNumber versionNumber) { return doWriteTransfer(versionNumber); }
+    bool writeTransfer(ChimeraTK::VersionNumber versionNumber) {
+      if(_transferStatistics) {
+        auto start = std::chrono::steady_clock::now();
+        bool dataLost = doWriteTransfer(versionNumber);
+        _transferStatistics->recordWrite(std::chrono::steady_clock::now() - start);
+        return dataLost;
+      }
+      return doWriteTransfer(versionNumber);
+    }
 
    protected:
     /**
@@ -623,6 +658,12 @@ namespace ChimeraTK {
      *  thrown in doWriteTransfer() are caught and rethrown in postWrite().
      */
     bool writeTransferDestructively(ChimeraTK::VersionNumber versionNumber) {
+      if(_transferStatistics) {
+        auto start = std::chrono::steady_clock::now();
+        bool dataLost = doWriteTransferDestructively(versionNumber);
+        _transferStatistics->recordWrite(std::chrono::steady_clock::now() - start);
+        return dataLost;
+      }
       return doWriteTransferDestructively(versionNumber);
     }
 
@@ -670,6 +711,20 @@ namespace ChimeraTK {
       return false;
     }
 
+    /**
+     *  Return the key used by TransferGroup::addAccessors() to find candidates for replaceTransferElement()
+     * efficiently. Only elements of the same type and with the same name (first member) are offered to each other, in
+     * the order of the position (second member), e.g. an address. Elements which may replace each other (see
+     * mayReplaceOther()) must have the same key. Elements which can be merged must have the same name, and the
+     * position must be chosen such that an element can only be merged with elements at the same or a neighbouring
+     * position.
+     *
+     *  The default implementation returns the name with position 0. Implementations which can be created multiple
+     * times for the same name with different content (e.g. slices of a register) should return different positions
+     * in this case, so the TransferGroup does not need to compare all of them with each other.
+     */
+    virtual std::pair<std::string, uint64_t> getReplacementKey() const { return {_name, 0}; }
+
     /**
      *  Obtain the underlying TransferElements with actual hardware access. If
      * this transfer element is directly reading from / writing to the hardware,
@@ -728,6 +783,38 @@ namespace ChimeraTK {
      * accessors which are replaced on the abstractor level. */
     virtual boost::shared_ptr<TransferElement> makeCopyRegisterDecorator() = 0;
 
+    /**
+     * Batch of low-level TransferElements, whose read transfers are executed together. This is used by the
+     * TransferGroup, so a backend can have several reads in flight at the same time (see createReadBatch()).
+     */
+    class ReadBatch {
+     public:
+      virtual ~ReadBatch() = default;
+
+      /**
+       * Try to add the given low-level element to the batch. Returns false (and does nothing) if the element cannot be
+       * read together with the elements already in the batch.
+       */
+      virtual bool add(const boost::shared_ptr<TransferElement>& element) = 0;
+
+      /** Return the number of elements in the batch. */
+      [[nodiscard]] virtual size_t size() const = 0;
+
+      /**
+       * Execute the read transfers of all elements in the batch. This replaces the call to readTransfer() of each
+       * element, including the exception handling: runtime errors and boost::thread_interrupted are not thrown but set
+       * as active exception on the affected elements (see setActiveException()).
+       */
+      virtual void readTransfer() = 0;
+    };
+
+    /**
+     * Create a ReadBatch containing only this element, to which further elements can be added. Returns a nullptr if
+     * the element does not support batched reads, which is the default. Only low-level elements (see
+     * getHardwareAccessingElements()) without AccessMode::wait_for_new_data may implement this.
+     */
+    virtual std::unique_ptr<ReadBatch> createReadBatch() { return nullptr; }
+
     /** Constant string to be used as a unit when the unit is not provided or
      * known */
     static constexpr char unitNotSet[] = "n./a.";
@@ -794,6 +881,28 @@ namespace ChimeraTK {
       dataTransportQueue.push_overwrite_exception(std::make_exception_ptr(boost::thread_interrupted()));
     }
 
+    /**
+     *  Attach a TransferStatistics object to this TransferElement. All subsequent calls to readTransfer(),
+     *  readTransferNonBlocking() (if new data was received), writeTransfer() and writeTransferDestructively() are
+     *  recorded in it. Pass a nullptr to disable the statistics again. Transfers which throw an exception are not
+     *  recorded.
+     *
+     *  The TransferGroup calls the transfer functions of the low-level elements only. It records the transfers of its
+     *  high-level elements explicitly instead, each with the summed durations of the transfers of its own low-level
+     *  elements. For elements with AccessMode::wait_for_new_data, the latency of readTransfer() includes the time spent
+     *  waiting for new data.
+     *
+     *  This function must not be called concurrently with a transfer.
+     */
+    void setTransferStatistics(boost::shared_ptr<TransferStatistics> statistics) {
+      _transferStatistics = std::move(statistics);
+    }
+
+    /** Return the TransferStatistics attached to this TransferElement, or a nullptr if none is attached. */
+    [[nodiscard]] boost::shared_ptr<const TransferStatistics> getTransferStatistics() const {
+      return _transferStatistics;
+    }
+
     /** Check whether a read transaction is in progress, i.e. preRead() has been called but not yet postRead(). */
     bool isReadTransactionInProgress() const { return readTransactionInProgress; }
 
@@ -838,6 +947,9 @@ namespace ChimeraTK {
      *  readTransactionInProgress but affects preWrite() and postWrite(). */
     bool writeTransactionInProgress{false};
 
+    /** Statistics of the transfers, see setTransferStatistics(). A nullptr if disabled. */
+    boost::shared_ptr<TransferStatistics> _transferStatistics;
+
    protected:
     /// The queue for asynchronous read transfers. This is the void queue which is a continuation of the actual data
     /// transport queue, which is implementation dependent. With _readQueue the exception propagation and waiting for
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <boost/shared_ptr.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   *  Counters and latency histograms for the transfers of a TransferElement, or aggregated over all TransferElements of
+   *  a backend.
+   *
+   *  The statistics are recorded in TransferElement::readTransfer(), readTransferNonBlocking() and writeTransfer()
+   *  (resp. writeTransferDestructively()), only if a TransferStatistics object has been attached to the element (see
+   *  DeviceBackendImpl::enableTransferStatistics()). Without statistics, the only overhead is a check for a null
+   *  pointer.
+   *
+   *  All recording functions are lock free and can be called concurrently with get() and reset() from other threads.
+   *  A Snapshot obtained with get() is consistent per counter but not necessarily across counters.
+   */
+  class TransferStatistics {
+   public:
+    /**
+     *  Number of buckets of the latency histograms. Bucket i counts transfers with a latency in [2^i, 2^(i+1))
+     *  nanoseconds (bucket 0 includes a latency of 0). The last bucket also counts all longer transfers.
+     */
+    static constexpr size_t nLatencyBuckets = 32;
+
+    using Histogram = std::array<uint64_t, nLatencyBuckets>;
+
+    /** Plain copy of all counters, as returned by get(). */
+    struct Snapshot {
+      uint64_t nReads{0};
+      uint64_t nWrites{0};
+      uint64_t nBytesRead{0};
+      uint64_t nBytesWritten{0};
+      std::chrono::nanoseconds totalReadLatency{0};
+      std::chrono::nanoseconds totalWriteLatency{0};
+      Histogram readLatencyHistogram{};
+      Histogram writeLatencyHistogram{};
+
+      /** Lower bound of the latency bucket with the given index */
+      static std::chrono::nanoseconds bucketLowerBound(size_t bucket);
+
+      /**
+       *  Estimate the given quantile (0..1) of the latency from the histogram. The result is the upper bound of the
+       *  bucket containing the quantile, i.e. it is accurate within a factor of 2. Returns 0 if no transfer has been
+       *  recorded.
+       */
+      static std::chrono::nanoseconds latencyQuantile(const Histogram& histogram, double quantile);
+    };
+
+    /**
+     *  Create statistics for a single TransferElement, which moves bytesPerTransfer bytes of user data in each
+     *  transfer. If a parent is given (typically the statistics of the backend), all transfers are recorded there as
+     *  well.
+     */
+    explicit TransferStatistics(size_t bytesPerTransfer = 0, boost::shared_ptr<TransferStatistics> parent = {});
+
+    /** Record a completed read transfer with the given latency. */
+    void recordRead(std::chrono::nanoseconds latency) noexcept { recordRead(_bytesPerTransfer, latency); }
+
+    /** Record a completed write transfer with the given latency. */
+    void recordWrite(std::chrono::nanoseconds latency) noexcept { recordWrite(_bytesPerTransfer, latency); }
+
+    /** Obtain a copy of the current counters. */
+    [[nodiscard]] Snapshot get() const;
+
+    /** Reset all counters to zero. The parent is not affected. */
+    void reset() noexcept;
+
+    /** Return the number of bytes of user data which are accounted for each transfer. */
+    [[nodiscard]] size_t getBytesPerTransfer() const { return _bytesPerTransfer; }
+
+   private:
+    struct Counters {
+      std::atomic<uint64_t> nTransfers{0};
+      std::atomic<uint64_t> nBytes{0};
+      std::atomic<int64_t> totalLatency{0};
+      std::array<std::atomic<uint64_t>, nLatencyBuckets> histogram{};
+
+      void record(size_t bytes, std::chrono::nanoseconds latency) noexcept;
+      void reset() noexcept;
+    };
+
+    void recordRead(size_t bytes, std::chrono::nanoseconds latency) noexcept;
+    void recordWrite(size_t bytes, std::chrono::nanoseconds latency) noexcept;
+
+    size_t _bytesPerTransfer;
+    boost::shared_ptr<TransferStatistics> _parent;
+    Counters _reads;
+    Counters _writes;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
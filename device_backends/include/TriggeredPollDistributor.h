@@ -6,13 +6,39 @@
 #include "InterruptControllerHandler.h"
 #include "TransferGroup.h"
 
+#include <map>
 #include <memory>
+#include <tuple>
+#include <typeindex>
 
 namespace ChimeraTK {
+
+  /**
+   *  Synchronous accessor which is shared by all PolledAsyncVariables with identical register, UserType, offset,
+   *  length and access mode flags, so the raw-to-cooked conversion is done only once per trigger.
+   */
+  template<typename UserType>
+  struct SharedPollSource {
+    explicit SharedPollSource(boost::shared_ptr<NDRegisterAccessor<UserType>> syncAccessor_)
+    : syncAccessor(std::move(syncAccessor_)) {}
+
+    boost::shared_ptr<NDRegisterAccessor<UserType>> syncAccessor;
+
+    /** Number of PolledAsyncVariables using this source */
+    size_t nUsers{0};
+
+    /** Number of PolledAsyncVariables which have already filled their send buffer in the current distribution */
+    size_t nFilled{0};
+  };
+
+  /********************************************************************************************************************/
+
   /**
    *  The TriggeredPollDistributor has std::nullptr_t source data type and is polling the data for the AsyncVariables
    *  via synchronous accessors in TransferGroup.
    *
+   *  AsyncVariables for the same register with identical UserType, offset, length and flags share a single synchronous
+   *  accessor (see SharedPollSource).
    */
   class TriggeredPollDistributor : public SourceTypedAsyncAccessorManager<std::nullptr_t> {
    public:
@@ -28,6 +54,13 @@ namespace ChimeraTK {
    protected:
     TransferGroup _transferGroup;
     boost::shared_ptr<TriggerDistributor> _parent;
+
+    /** Register name, UserType, number of words, offset and (synchronous) flags */
+    using PollSourceKey = std::tuple<std::string, std::type_index, size_t, size_t, AccessModeFlags>;
+
+    /** The SharedPollSource for each key. The type of the pointer is SharedPollSource<UserType> with the UserType from
+     *  the key. */
+    std::map<PollSourceKey, boost::shared_ptr<void>> _pollSources;
   };
 
   /********************************************************************************************************************/
@@ -36,19 +69,27 @@ namespace ChimeraTK {
    */
   template<typename UserType>
   struct PolledAsyncVariable : public AsyncVariableImpl<UserType> {
+    /** Copies the polled data from the shared source into the send buffer. The last variable of a source to be filled
+     *  in a distribution takes over the buffer by swapping instead of copying.
+     */
     void fillSendBuffer() final;
 
-    /** The constructor takes an already created synchronous accessor and a reference to the version variable.
+    /** The constructor takes an already created shared source and a reference to the version variable. If the source
+     *  is already in use, the initial value must be polled with a separate initialValueAccessor_, because the buffer
+     *  of the shared accessor has already been handed out in the last distribution.
      */
-    explicit PolledAsyncVariable(boost::shared_ptr<NDRegisterAccessor<UserType>> syncAccessor_, VersionNumber& v);
+    PolledAsyncVariable(boost::shared_ptr<SharedPollSource<UserType>> source_, VersionNumber& v,
+        boost::shared_ptr<NDRegisterAccessor<UserType>> initialValueAccessor_ = {});
+    ~PolledAsyncVariable() override;
 
-    boost::shared_ptr<NDRegisterAccessor<UserType>> syncAccessor;
+    boost::shared_ptr<SharedPollSource<UserType>> source;
+    boost::shared_ptr<NDRegisterAccessor<UserType>> initialValueAccessor;
     VersionNumber& _version;
 
-    unsigned int getNumberOfChannels() override { return syncAccessor->getNumberOfChannels(); }
-    unsigned int getNumberOfSamples() override { return syncAccessor->getNumberOfSamples(); }
-    const std::string& getUnit() override { return syncAccessor->getUnit(); }
-    const std::string& getDescription() override { return syncAccessor->getDescription(); }
+    unsigned int getNumberOfChannels() override { return source->syncAccessor->getNumberOfChannels(); }
+    unsigned int getNumberOfSamples() override { return source->syncAccessor->getNumberOfSamples(); }
+    const std::string& getUnit() override { return source->syncAccessor->getUnit(); }
+    const std::string& getDescription() override { return source->syncAccessor->getDescription(); }
   };
 
   /********************************************************************************************************************/
@@ -60,36 +101,85 @@ namespace ChimeraTK {
       AccessorInstanceDescriptor const& descriptor) {
     auto synchronousFlags = descriptor.flags;
     synchronousFlags.remove(AccessMode::wait_for_new_data);
-    // Don't call backend->getSyncRegisterAccessor() here. It might skip the overriding of a backend.
-    auto syncAccessor = _backend->getRegisterAccessor<UserType>(
-        descriptor.name, descriptor.numberOfWords, descriptor.wordOffsetInRegister, synchronousFlags);
-    // read the initial value before adding it to the transfer group
-    if(_asyncDomain->unsafeGetIsActive()) {
-      try {
-        syncAccessor->read();
+
+    auto readInitialValue = [&](const boost::shared_ptr<NDRegisterAccessor<UserType>>& syncAccessor) {
+      if(_asyncDomain->unsafeGetIsActive()) {
+        try {
+          syncAccessor->read();
+        }
+        catch(ChimeraTK::runtime_error&) {
+          // Nothing to do here. The backend's setException() has already been called by the syncAccessor.
+        }
       }
-      catch(ChimeraTK::runtime_error&) {
-        // Nothing to do here. The backend's setException() has already been called by the syncAccessor.
+    };
+
+    // Don't call backend->getSyncRegisterAccessor() here. It might skip the overriding of a backend.
+    auto getSyncAccessor = [&] {
+      return _backend->getRegisterAccessor<UserType>(
+          descriptor.name, descriptor.numberOfWords, descriptor.wordOffsetInRegister, synchronousFlags);
+    };
+
+    auto& untypedSource = _pollSources[PollSourceKey{std::string(descriptor.name), descriptor.type,
+        descriptor.numberOfWords, descriptor.wordOffsetInRegister, synchronousFlags}];
+    if(untypedSource) {
+      auto source = boost::static_pointer_cast<SharedPollSource<UserType>>(untypedSource);
+      boost::shared_ptr<NDRegisterAccessor<UserType>> initialValueAccessor;
+      if(_asyncDomain->unsafeGetIsActive()) {
+        initialValueAccessor = getSyncAccessor();
+        readInitialValue(initialValueAccessor);
       }
+      return std::make_unique<PolledAsyncVariable<UserType>>(source, _version, initialValueAccessor);
     }
 
+    auto syncAccessor = getSyncAccessor();
+    // read the initial value before adding it to the transfer group
+    readInitialValue(syncAccessor);
     _transferGroup.addAccessor(syncAccessor);
-    return std::make_unique<PolledAsyncVariable<UserType>>(syncAccessor, _version);
+
+    auto source = boost::make_shared<SharedPollSource<UserType>>(syncAccessor);
+    untypedSource = source;
+    return std::make_unique<PolledAsyncVariable<UserType>>(source, _version);
   }
 
   /********************************************************************************************************************/
   template<typename UserType>
   void PolledAsyncVariable<UserType>::fillSendBuffer() {
     this->_sendBuffer.versionNumber = _version;
+
+    if(initialValueAccessor) {
+      this->_sendBuffer.dataValidity = initialValueAccessor->dataValidity();
+      this->_sendBuffer.value.swap(initialValueAccessor->accessChannels());
+      initialValueAccessor.reset();
+      return;
+    }
+
+    auto& syncAccessor = source->syncAccessor;
     this->_sendBuffer.dataValidity = syncAccessor->dataValidity();
-    this->_sendBuffer.value.swap(syncAccessor->accessChannels());
+    // All variables of the source are filled exactly once per distribution. The buffer is overwritten by the next
+    // poll, so the last one can take it over.
+    if(++source->nFilled == source->nUsers) {
+      source->nFilled = 0;
+      this->_sendBuffer.value.swap(syncAccessor->accessChannels());
+    }
+    else {
+      this->_sendBuffer.value = syncAccessor->accessChannels();
+    }
+  }
+
+  /********************************************************************************************************************/
+  template<typename UserType>
+  PolledAsyncVariable<UserType>::PolledAsyncVariable(boost::shared_ptr<SharedPollSource<UserType>> source_,
+      VersionNumber& v, boost::shared_ptr<NDRegisterAccessor<UserType>> initialValueAccessor_)
+  : AsyncVariableImpl<UserType>(
+        source_->syncAccessor->getNumberOfChannels(), source_->syncAccessor->getNumberOfSamples()),
+    source(std::move(source_)), initialValueAccessor(std::move(initialValueAccessor_)), _version(v) {
+    ++source->nUsers;
   }
 
   /********************************************************************************************************************/
   template<typename UserType>
-  PolledAsyncVariable<UserType>::PolledAsyncVariable(
-      boost::shared_ptr<NDRegisterAccessor<UserType>> syncAccessor_, VersionNumber& v)
-  : AsyncVariableImpl<UserType>(syncAccessor_->getNumberOfChannels(), syncAccessor_->getNumberOfSamples()),
-    syncAccessor(syncAccessor_), _version(v) {}
+  PolledAsyncVariable<UserType>::~PolledAsyncVariable() {
+    --source->nUsers;
+  }
 
 } // namespace ChimeraTK
@@ -2,12 +2,16 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 #pragma once
 
+#include "IoUring.h"
 #include "NumericAddressedBackend.h"
 
 #include <boost/function.hpp>
 
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace ChimeraTK {
 
@@ -21,6 +25,22 @@ namespace ChimeraTK {
     uint64_t _ioctlDriverVersion;
     uint64_t _ioctlDMA;
     std::string _deviceNodeName;
+    size_t _maximumMergeGap;
+
+    /// Upper limit of the parameter "mergeGap". A merged transfer also transfers the gaps.
+    static constexpr size_t _maxMergeGap = 1024 * 1024;
+
+    /// the driver supports pread() on the bars (pcieuni), which is then used for the normal reads
+    bool _hasDirectRead{false};
+
+    /// submit the reads of readMultiple() through io_uring
+    bool _useIoUring{false};
+    std::unique_ptr<detail::IoUring> _ioUring;
+
+    /// Storage for readMultiple(), kept to avoid allocations for each call. Protected by _readMultipleMutex.
+    std::mutex _readMultipleMutex;
+    std::vector<detail::FileTransfer> _readMultipleTransfers;
+    std::vector<ReadRequest*> _requestOfTransfer;
 
     /// A function pointer which calls the correct dma read function (via ioctl or
     /// via struct)
@@ -53,12 +73,14 @@ namespace ChimeraTK {
 
     size_t minimumTransferAlignment([[maybe_unused]] uint64_t bar) const override { return 4; }
 
+    size_t maximumMergeGap([[maybe_unused]] uint64_t bar) const override { return _maximumMergeGap; }
+
     bool checkConnection() const;
 
     /** constructor called through createInstance to create device object */
 
    public:
-    explicit PcieBackend(std::string deviceNodeName, const std::string& mapFileName = "");
+    explicit PcieBackend(std::string deviceNodeName, const std::string& mapFileName = "", size_t maximumMergeGap = 0);
     ~PcieBackend() override;
 
     void open() override;
@@ -66,11 +88,16 @@ namespace ChimeraTK {
 
     void read(uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes) override;
     void write(uint8_t bar, uint32_t address, int32_t const* data, size_t sizeInBytes) override;
+    void readMultiple(std::vector<ReadRequest>& requests) override;
 
     std::string readDeviceInfo() override;
 
-    /*Host or parameters (at least for now) are just place holders as pcidevice
-     * does not use them*/
+    /* Supported parameters are "map" (map file name), "mergeGap" (maximum gap in bytes between two merged
+     * transfers, up to 1 MiB, see NumericAddressedBackend::maximumMergeGap(), default 0), "ioUring" (0 or 1, default
+     * 0: if 1, the reads of a TransferGroup from the bars 0 to 5 are submitted at once through io_uring, see
+     * NumericAddressedBackend::readMultiple(). Only supported by the pcieuni driver, DMA reads are not affected.) and
+     * the parameters handled by NumericAddressedBackend::applyCommonParameters(). Only "map" can be given in the
+     * (deprecated) SDM syntax, all other parameters require the CDD syntax. */
     static boost::shared_ptr<DeviceBackend> createInstance(
         std::string address, std::map<std::string, std::string> parameters);
   };
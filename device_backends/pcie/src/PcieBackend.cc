@@ -3,6 +3,8 @@
 
 #include "PcieBackend.h"
 
+#include "Utilities.h"
+
 // the io constants and struct for the driver
 #include "llrfdrv_io_compat.h"
 #include "pciedev_io_compat.h"
@@ -23,9 +25,9 @@
 
 namespace ChimeraTK {
 
-  PcieBackend::PcieBackend(std::string deviceNodeName, const std::string& mapFileName)
+  PcieBackend::PcieBackend(std::string deviceNodeName, const std::string& mapFileName, size_t maximumMergeGap)
   : NumericAddressedBackend(mapFileName), _deviceID(0), _ioctlPhysicalSlot(0), _ioctlDriverVersion(0), _ioctlDMA(0),
-    _deviceNodeName(std::move(deviceNodeName)) {}
+    _deviceNodeName(std::move(deviceNodeName)), _maximumMergeGap(maximumMergeGap) {}
 
   PcieBackend::~PcieBackend() {
     close();
@@ -46,10 +48,16 @@ namespace ChimeraTK {
 
     determineDriverAndConfigureIoctl();
 
+    if(_useIoUring && _hasDirectRead && !_ioUring) {
+      _ioUring = std::make_unique<detail::IoUring>();
+    }
+
     setOpenedAndClearException();
   }
 
   void PcieBackend::determineDriverAndConfigureIoctl() {
+    _hasDirectRead = false;
+
     // determine the driver by trying the physical slot ioctl
     device_ioctrl_data ioctlData = {0, 0, 0, 0};
 
@@ -101,6 +109,7 @@ namespace ChimeraTK {
       _readFunction = [&](uint8_t bar, uint32_t address, int32_t* data, size_t sizeInBytes) {
         directRead(bar, address, data, sizeInBytes);
       };
+      _hasDirectRead = true;
       return;
     }
 
@@ -204,6 +213,46 @@ namespace ChimeraTK {
     }
   }
 
+  void PcieBackend::readMultiple(std::vector<ReadRequest>& requests) {
+    if(!_ioUring || !_hasDirectRead) {
+      NumericAddressedBackend::readMultiple(requests);
+      return;
+    }
+    checkActiveException();
+
+    // Submit the reads of the bars 0 to 5 at once. DMA reads use an ioctl, which cannot be submitted through io_uring.
+    std::lock_guard<std::mutex> lock(_readMultipleMutex);
+    auto& transfers = _readMultipleTransfers;
+    auto& requestOfTransfer = _requestOfTransfer;
+    transfers.clear();
+    requestOfTransfer.clear();
+    for(auto& request : requests) {
+      if(request.bar > 5) {
+        try {
+          NumericAddressedBackend::read(request.bar, request.address, request.data, request.sizeInBytes);
+        }
+        catch(ChimeraTK::runtime_error&) {
+          request.error = std::current_exception();
+        }
+        continue;
+      }
+      uint64_t virtualOffset = PCIEUNI_BAR_OFFSETS[request.bar] + request.address;
+      transfers.push_back({_deviceID, false, request.data, request.sizeInBytes, virtualOffset});
+      requestOfTransfer.push_back(&request);
+    }
+
+    _ioUring->execute(transfers);
+
+    for(size_t i = 0; i < transfers.size(); ++i) {
+      auto result = transfers[i].result;
+      if(result != static_cast<ssize_t>(transfers[i].nBytes)) {
+        std::string reason = result < 0 ? std::strerror(int(-result)) : "read " + std::to_string(result) + " bytes";
+        requestOfTransfer[i]->error = std::make_exception_ptr(
+            ChimeraTK::runtime_error("Cannot read data from device: " + _deviceNodeName + ": " + reason));
+      }
+    }
+  }
+
   void PcieBackend::writeWithStruct(uint8_t bar, uint32_t address, int32_t const* data, size_t sizeInBytes) {
     assert(_opened);
     assert(sizeInBytes % 4 == 0);
@@ -310,7 +359,25 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("Device address not specified.");
     }
 
-    return boost::shared_ptr<DeviceBackend>(new PcieBackend("/dev/" + address, parameters["map"]));
+    size_t maximumMergeGap = 0;
+    auto it = parameters.find("mergeGap");
+    if(it != parameters.end()) {
+      maximumMergeGap = Utilities::parseIntegerParameter("mergeGap", it->second, 0, _maxMergeGap);
+    }
+
+    auto backend =
+        boost::shared_ptr<PcieBackend>(new PcieBackend("/dev/" + address, parameters["map"], maximumMergeGap));
+    backend->applyCommonParameters(parameters);
+
+    it = parameters.find("ioUring");
+    if(it != parameters.end()) {
+      if(it->second != "0" && it->second != "1") {
+        throw ChimeraTK::logic_error(
+            "PcieBackend: Invalid value for parameter 'ioUring' (must be 0 or 1): '" + it->second + "'");
+      }
+      backend->_useIoUring = (it->second == "1");
+    }
+    return backend;
   }
 
 } // namespace ChimeraTK
@@ -12,6 +12,16 @@ namespace ChimeraTK {
     asyncVariableMapChanged(id);
     // The destructor of the AsyncVariable implementation must do all necessary clean-up
     _asyncVariables.erase(id);
+    updateSubscriberList();
+  }
+
+  /********************************************************************************************************************/
+  void AsyncAccessorManager::updateSubscriberList() {
+    _subscribers.clear();
+    _subscribers.reserve(_asyncVariables.size());
+    for(auto& var : _asyncVariables) {
+      _subscribers.push_back(var.second.get());
+    }
   }
   /********************************************************************************************************************/
   void AsyncAccessorManager::unsubscribe(TransferElementID id) {
@@ -29,8 +39,8 @@ namespace ChimeraTK {
     _isHoldingDomainLock = this;
     assert(_delayedUnsubscriptions.empty());
 
-    for(auto& var : _asyncVariables) {
-      var.second->sendException(e);
+    for(auto* var : _subscribers) {
+      var->sendException(e);
     }
     _isHoldingDomainLock = nullptr;
 
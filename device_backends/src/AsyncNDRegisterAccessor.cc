@@ -5,6 +5,8 @@
 
 #include "AsyncAccessorManager.h"
 
+#include <algorithm>
+
 namespace ChimeraTK {
 
   template<typename UserType>
@@ -19,7 +21,9 @@ namespace ChimeraTK {
       std::string const& unit, std::string const& description)
 
   : NDRegisterAccessor<UserType>(name, accessModeFlags, unit, description), _backend(std::move(backend)),
-    _accessorManager(std::move(manager)), _asyncDomain(std::move(asyncDomain)), _receiveBuffer(nChannels, nElements) {
+    _accessorManager(std::move(manager)), _asyncDomain(std::move(asyncDomain)),
+    _receiveEntry{Buffer(nChannels, nElements)}, _sendEntry{Buffer(nChannels, nElements)},
+    _nChannels(nChannels), _nElements(nElements), _queueConfig(_asyncDomain->getQueueConfig()) {
     // Don't throw a ChimeraTK::logic_error here. They are for mistakes an application is doing when using DeviceAccess.
     // If an AsyncNDRegisterAccessor is created without wait_for_new_data it is a mistake in the backend, which is not
     // part of the application.
@@ -31,15 +35,15 @@ namespace ChimeraTK {
     // * write once and then read,
     // * repeat n+1 times to make sure all buffers inside the queue have been replaced with
     //   a properly sized buffer, so it can be swapped out and used for data
-    for(size_t i = 0; i < _queueSize + 1; ++i) {
-      Buffer b1(nChannels, nElements);
-      _dataTransportQueue.push(std::move(b1));
-      Buffer b2(nChannels, nElements);
-      _dataTransportQueue.pop(b2); // here b2 is swapped into the queue and transported "backwards"
+    for(size_t i = 0; i < _queueConfig.length + 1; ++i) {
+      QueueEntry e1{Buffer(nChannels, nElements)};
+      _dataTransportQueue.push(std::move(e1));
+      QueueEntry e2{Buffer(nChannels, nElements)};
+      _dataTransportQueue.pop(e2); // here e2 is swapped into the queue and transported "backwards"
     }
 
     this->_readQueue = _dataTransportQueue.template then<void>(
-        [&](Buffer& buf) { std::swap(_receiveBuffer, buf); }, std::launch::deferred);
+        [&](QueueEntry& entry) { std::swap(_receiveEntry, entry); }, std::launch::deferred);
   }
 
   /********************************************************************************************************************/
@@ -48,13 +52,15 @@ namespace ChimeraTK {
     if(updateDataBuffer) {
       // do not update meta data if updateDataBuffer == false, since this is the equivalent to a backend
       // implementation, not a decorator
-      this->_versionNumber = _receiveBuffer.versionNumber;
-      this->_dataValidity = _receiveBuffer.dataValidity;
+      this->_versionNumber = _receiveEntry.buffer.versionNumber;
+      this->_dataValidity = _receiveEntry.buffer.dataValidity;
+      _nCoalescedInterrupts = _receiveEntry.nCoalescedInterrupts;
       // Do not overwrite the vectors in the first layer of the 2D array. Accessing code might have stored them.
       // Instead, swap the received data into the channel vectors.
-      auto source = _receiveBuffer.value.begin(); // the received data is the source as it is moved into the user buffer
+      // the received data is the source as it is moved into the user buffer
+      auto source = _receiveEntry.buffer.value.begin();
       auto destination = this->buffer_2D.begin();
-      for(; source != _receiveBuffer.value.end(); ++source, ++destination) {
+      for(; source != _receiveEntry.buffer.value.end(); ++source, ++destination) {
         destination->swap(*source);
       }
     }
@@ -63,8 +69,34 @@ namespace ChimeraTK {
   /********************************************************************************************************************/
   template<typename UserType>
   void AsyncNDRegisterAccessor<UserType>::sendDestructively(typename NDRegisterAccessor<UserType>::Buffer& data) {
-    if(_asyncDomain->unsafeGetIsActive()) {
-      _dataTransportQueue.push_overwrite(std::move(data));
+    if(!_asyncDomain->unsafeGetIsActive()) {
+      return;
+    }
+
+    // The buffer handed back by the queue is refilled by the caller, which must not need to allocate.
+    auto checkRecycledBuffer = cppext::finally([&] {
+      assert(data.value.size() == _nChannels);
+      assert(std::all_of(data.value.begin(), data.value.end(), [&](auto& c) { return c.size() == _nElements; }));
+    });
+
+    // The number of coalesced interrupts travels through the queue together with the value. Only the buffers are
+    // swapped, the buffer handed back by the queue ends up in data again.
+    std::swap(_sendEntry.buffer, data);
+    _sendEntry.nCoalescedInterrupts = _asyncDomain->unsafeGetNumberOfCoalescedInterrupts();
+    auto swapBack = cppext::finally([&] { std::swap(_sendEntry.buffer, data); });
+
+    switch(_queueConfig.policy) {
+      case AsyncQueueConfig::OverflowPolicy::overwriteLast:
+        if(!_dataTransportQueue.push_overwrite(std::move(_sendEntry))) {
+          ++_nOverflows;
+        }
+        return;
+
+      case AsyncQueueConfig::OverflowPolicy::dropNewest:
+        if(!_dataTransportQueue.push(std::move(_sendEntry))) {
+          ++_nOverflows;
+        }
+        return;
     }
   }
 
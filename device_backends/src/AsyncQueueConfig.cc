@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "AsyncQueueConfig.h"
+
+#include "Exception.h"
+#include "Utilities.h"
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  AsyncQueueConfig AsyncQueueConfig::fromParameters(const std::map<std::string, std::string>& parameters) {
+    AsyncQueueConfig config;
+
+    auto it = parameters.find("asyncQueueLength");
+    if(it != parameters.end()) {
+      config.length = Utilities::parseIntegerParameter("asyncQueueLength", it->second, 1, maxLength);
+    }
+
+    it = parameters.find("asyncOverflowPolicy");
+    if(it != parameters.end()) {
+      if(it->second == "overwriteLast") {
+        config.policy = OverflowPolicy::overwriteLast;
+      }
+      else if(it->second == "dropNewest") {
+        config.policy = OverflowPolicy::dropNewest;
+      }
+      else {
+        throw ChimeraTK::logic_error(
+            "Invalid value for parameter 'asyncOverflowPolicy' (must be overwriteLast or dropNewest): '" + it->second +
+            "'");
+      }
+    }
+
+    return config;
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
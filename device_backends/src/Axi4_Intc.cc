@@ -3,28 +3,85 @@
 #include "Axi4_Intc.h"
 
 #include "TriggerDistributor.h"
+#include <nlohmann/json.hpp>
 
 namespace ChimeraTK {
 
+  Axi4_Intc::Axi4_Intc(InterruptControllerHandlerFactory* controllerHandlerFactory,
+      std::vector<uint32_t> const& controllerID, boost::shared_ptr<TriggerDistributor> parent,
+      RegisterPath const& path, bool usePendingRegister)
+  : InterruptControllerHandler(controllerHandlerFactory, controllerID, std::move(parent)), _path(path) {
+    _pendingInterrupts =
+        _backend->getRegisterAccessor<uint32_t>(_path / (usePendingRegister ? "IPR" : "ISR"), 1, 0, {});
+    if(!_pendingInterrupts->isReadable()) {
+      throw ChimeraTK::logic_error("Axi4_Intc: Status register not readable: " + _pendingInterrupts->getName());
+    }
+    _acknowledge = _backend->getRegisterAccessor<uint32_t>(_path / "IAR", 1, 0, {});
+    if(!_acknowledge->isWriteable()) {
+      throw ChimeraTK::logic_error("Axi4_Intc: Acknowledge register not writeable: " + _acknowledge->getName());
+    }
+  }
+
+  /********************************************************************************************************************/
+
   void Axi4_Intc::handle(VersionNumber version) {
-    // Stupid testing implementation that always triggers all children
-    for(auto& distributorIter : _distributors) {
-      auto distributor = distributorIter.second.lock();
-      // The weak pointer might have gone.
-      // FIXME: We need a cleanup function which removes the map entry. Otherwise we might
-      // be stuck with a bad weak pointer wich is tried in each handle() call.
-      if(distributor) {
-        distributor->distribute(nullptr, version);
+    try {
+      _pendingInterrupts->read();
+      uint32_t pending = _pendingInterrupts->accessData(0);
+      if(pending == 0) {
+        return;
       }
+
+      // Acknowledge everything in one go before distributing, so an interrupt which fires again while the
+      // distributors are polling is not lost.
+      _acknowledge->accessData(0) = pending;
+      _acknowledge->write();
+
+      while(pending != 0) {
+        auto i = static_cast<uint32_t>(__builtin_ctz(pending));
+        pending &= pending - 1; // clear lowest set bit
+        auto distributorIter = _distributors.find(i);
+        if(distributorIter == _distributors.end()) {
+          continue; // nobody has subscribed to this interrupt
+        }
+        auto distributor = distributorIter->second.lock();
+        if(distributor) {
+          distributor->distribute(nullptr, version);
+        }
+      }
+    }
+    catch(ChimeraTK::runtime_error&) {
+      // Nothing to do. The transferElement part of the accessors has already called the backend's setException
     }
   }
 
   /********************************************************************************************************************/
 
   std::unique_ptr<Axi4_Intc> Axi4_Intc::create(InterruptControllerHandlerFactory* controllerHandlerFactory,
-      std::vector<uint32_t> const& controllerID, [[maybe_unused]] std::string const& desrciption,
+      std::vector<uint32_t> const& controllerID, std::string const& desrciption,
       boost::shared_ptr<TriggerDistributor> parent) {
-    return std::make_unique<Axi4_Intc>(controllerHandlerFactory, controllerID, std::move(parent));
+    std::string path;
+    bool usePendingRegister = false;
+    try {
+      auto jdescription = nlohmann::json::parse(desrciption);
+      path = jdescription.at("path").get<std::string>();
+      if(jdescription.contains("options")) {
+        for(auto& option : jdescription["options"]) {
+          auto optionName = option.get<std::string>();
+          if(optionName == "IPR") {
+            usePendingRegister = true;
+          }
+          else {
+            throw ChimeraTK::logic_error("Axi4_Intc: Unknown option '" + optionName + "'");
+          }
+        }
+      }
+    }
+    catch(nlohmann::json::exception& e) {
+      throw ChimeraTK::logic_error("Axi4_Intc: Invalid controller description '" + desrciption + "': " + e.what());
+    }
+    return std::make_unique<Axi4_Intc>(controllerHandlerFactory, controllerID, std::move(parent), path,
+        usePendingRegister);
   }
 
 } // namespace ChimeraTK
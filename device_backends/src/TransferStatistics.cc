@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "TransferStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  namespace {
+
+    size_t bucketIndex(std::chrono::nanoseconds latency) {
+      auto ns = latency.count();
+      if(ns <= 1) return 0;
+      // index of the highest set bit
+      size_t index = 63 - size_t(__builtin_clzll(uint64_t(ns)));
+      return std::min(index, TransferStatistics::nLatencyBuckets - 1);
+    }
+
+  } // namespace
+
+  /********************************************************************************************************************/
+
+  TransferStatistics::TransferStatistics(size_t bytesPerTransfer, boost::shared_ptr<TransferStatistics> parent)
+  : _bytesPerTransfer(bytesPerTransfer), _parent(std::move(parent)) {}
+
+  /********************************************************************************************************************/
+
+  void TransferStatistics::Counters::record(size_t bytes, std::chrono::nanoseconds latency) noexcept {
+    nTransfers.fetch_add(1, std::memory_order_relaxed);
+    nBytes.fetch_add(bytes, std::memory_order_relaxed);
+    totalLatency.fetch_add(latency.count(), std::memory_order_relaxed);
+    histogram[bucketIndex(latency)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferStatistics::Counters::reset() noexcept {
+    nTransfers = 0;
+    nBytes = 0;
+    totalLatency = 0;
+    for(auto& bucket : histogram) {
+      bucket = 0;
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferStatistics::recordRead(size_t bytes, std::chrono::nanoseconds latency) noexcept {
+    _reads.record(bytes, latency);
+    if(_parent) _parent->recordRead(bytes, latency);
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferStatistics::recordWrite(size_t bytes, std::chrono::nanoseconds latency) noexcept {
+    _writes.record(bytes, latency);
+    if(_parent) _parent->recordWrite(bytes, latency);
+  }
+
+  /********************************************************************************************************************/
+
+  TransferStatistics::Snapshot TransferStatistics::get() const {
+    Snapshot snapshot;
+    snapshot.nReads = _reads.nTransfers.load(std::memory_order_relaxed);
+    snapshot.nWrites = _writes.nTransfers.load(std::memory_order_relaxed);
+    snapshot.nBytesRead = _reads.nBytes.load(std::memory_order_relaxed);
+    snapshot.nBytesWritten = _writes.nBytes.load(std::memory_order_relaxed);
+    snapshot.totalReadLatency = std::chrono::nanoseconds(_reads.totalLatency.load(std::memory_order_relaxed));
+    snapshot.totalWriteLatency = std::chrono::nanoseconds(_writes.totalLatency.load(std::memory_order_relaxed));
+    for(size_t i = 0; i < nLatencyBuckets; ++i) {
+      snapshot.readLatencyHistogram[i] = _reads.histogram[i].load(std::memory_order_relaxed);
+      snapshot.writeLatencyHistogram[i] = _writes.histogram[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+  }
+
+  /********************************************************************************************************************/
+
+  void TransferStatistics::reset() noexcept {
+    _reads.reset();
+    _writes.reset();
+  }
+
+  /********************************************************************************************************************/
+
+  std::chrono::nanoseconds TransferStatistics::Snapshot::bucketLowerBound(size_t bucket) {
+    if(bucket == 0) return std::chrono::nanoseconds(0);
+    return std::chrono::nanoseconds(int64_t(1) << bucket);
+  }
+
+  /********************************************************************************************************************/
+
+  std::chrono::nanoseconds TransferStatistics::Snapshot::latencyQuantile(const Histogram& histogram, double quantile) {
+    uint64_t total = 0;
+    for(auto count : histogram) {
+      total += count;
+    }
+    if(total == 0) return std::chrono::nanoseconds(0);
+
+    auto rank = uint64_t(std::ceil(std::clamp(quantile, 0., 1.) * double(total)));
+    uint64_t seen = 0;
+    for(size_t i = 0; i < nLatencyBuckets; ++i) {
+      seen += histogram[i];
+      if(seen >= rank && histogram[i] > 0) {
+        return bucketLowerBound(i + 1);
+      }
+    }
+    return bucketLowerBound(nLatencyBuckets);
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
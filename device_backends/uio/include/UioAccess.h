@@ -5,9 +5,23 @@
 #include <boost/filesystem.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <string>
 
 namespace ChimeraTK {
+  namespace detail {
+    /// @brief Wait until the file descriptor becomes readable, like poll() for a single file descriptor with POLLIN.
+    /// For low latency, the file descriptor is first checked repeatedly without blocking for up to spinTime, so the
+    /// calling thread is not put to sleep if the event arrives within that time. Spinning occupies the CPU for up to
+    /// spinTime per call. Yielding in between only lets threads of the same or higher priority run, so a spinning
+    /// thread with a real-time policy like SCHED_FIFO starves normal threads on its CPU.
+    /// @param fileDescriptor File descriptor to wait for
+    /// @param timeoutMs Timeout period in ms for the blocking wait after spinning
+    /// @param spinTime Maximum time to spin. '0' disables spinning.
+    /// @return Return value of poll(): '1' if readable, '0' on timeout, '-1' on error (with errno set)
+    int pollWithSpin(int fileDescriptor, int timeoutMs, std::chrono::nanoseconds spinTime);
+  } // namespace detail
+
   /// @brief Implements a generic userspace interface for UIO devices.
   class UioAccess {
    private:
@@ -17,6 +31,7 @@ namespace ChimeraTK {
     void* _deviceKernelBase = nullptr;
     size_t _deviceMemSize = 0;
     uint32_t _lastInterruptCount = 0;
+    std::chrono::nanoseconds _spinTime{0};
     std::atomic<bool> _opened{false};
 
     /// @brief Maps user space memory range to address range of UIO device.
@@ -73,6 +88,10 @@ namespace ChimeraTK {
     /// @brief Clear all pending interrupts.
     void clearInterrupts();
 
+    /// @brief Set the time waitForInterrupt() spins before blocking (see detail::pollWithSpin()).
+    /// @param spinTime Maximum time to spin. '0' (default) disables spinning.
+    void setSpinTime(std::chrono::nanoseconds spinTime) { _spinTime = spinTime; }
+
     /// @brief Return UIO device file path.
     /// @return File path
     std::string getDeviceFilePath();
@@ -5,6 +5,7 @@
 #include "NumericAddressedBackend.h"
 #include "UioAccess.h"
 
+#include <optional>
 #include <thread>
 
 namespace ChimeraTK {
@@ -16,16 +17,36 @@ namespace ChimeraTK {
     std::thread _interruptWaitingThread;
     std::atomic<bool> _stopInterruptLoop{false}; // Used to shut down thread
 
+    // Low-latency settings for the interrupt thread, see createInstance()
+    std::optional<int> _interruptCpu;
+    std::optional<int> _interruptPriority;
+
     void waitForInterruptLoop(std::promise<void> subscriptionDonePromise);
 
+    // Apply CPU pinning and real-time priority to the calling thread, if configured
+    void configureInterruptThread();
+
     /* data */
    public:
     UioBackend(std::string deviceName, std::string mapFileName);
     ~UioBackend() override;
 
+    /* Supported parameters are "map" (map file name), the parameters handled by
+     * NumericAddressedBackend::applyCommonParameters() and the following options for low interrupt latency:
+     *  - "interruptSpinTime": time in microseconds to spin on the device file before the interrupt thread goes to
+     *    sleep, see detail::pollWithSpin(). Default is 0 (no spinning), the maximum is 10000 (10 ms).
+     *  - "interruptCpu": pin the interrupt thread to the given CPU
+     *  - "interruptPriority": run the interrupt thread with SCHED_FIFO and the given priority (1 to 99). Cannot be
+     *    combined with a non-zero "interruptSpinTime", since the spinning thread would starve other threads.
+     * If pinning or setting the priority fails at runtime (e.g. due to missing permissions), a warning is printed and
+     * the thread continues with the default settings. */
     static boost::shared_ptr<DeviceBackend> createInstance(
         std::string address, std::map<std::string, std::string> parameters);
 
+    /// Upper limit of the parameter "interruptSpinTime" in microseconds. Spinning longer does not reduce the latency
+    /// further, it only occupies the CPU.
+    static constexpr int maxInterruptSpinTime{10000};
+
     void open() override;
     void closeImpl() override;
 
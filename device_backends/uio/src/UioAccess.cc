@@ -11,9 +11,30 @@
 #include <fstream>
 #include <limits>
 #include <poll.h>
+#include <thread>
 
 namespace ChimeraTK {
 
+  int detail::pollWithSpin(int fileDescriptor, int timeoutMs, std::chrono::nanoseconds spinTime) {
+    struct pollfd pfd;
+    pfd.fd = fileDescriptor;
+    pfd.events = POLLIN;
+
+    if(spinTime.count() > 0) {
+      auto deadline = std::chrono::steady_clock::now() + spinTime;
+      do {
+        int ret = poll(&pfd, 1, 0);
+        if(ret != 0) {
+          return ret;
+        }
+        // Let other runnable threads of the same priority use the CPU. This does not help threads of lower priority.
+        std::this_thread::yield();
+      } while(std::chrono::steady_clock::now() < deadline);
+    }
+
+    return poll(&pfd, 1, timeoutMs);
+  }
+
   UioAccess::UioAccess(const std::string& deviceFilePath) : _deviceFilePath(deviceFilePath.c_str()) {}
 
   UioAccess::~UioAccess() {
@@ -90,11 +111,7 @@ namespace ChimeraTK {
     // Will hold the number of new interrupts
     uint32_t occurredInterruptCount = 0;
 
-    struct pollfd pfd;
-    pfd.fd = _deviceFileDescriptor;
-    pfd.events = POLLIN;
-
-    int ret = poll(&pfd, 1, timeoutMs);
+    int ret = detail::pollWithSpin(_deviceFileDescriptor, timeoutMs, _spinTime);
 
     if(ret >= 1) {
       // No timeout, start reading
@@ -3,8 +3,27 @@
 
 #include "UioBackend.h"
 
+#include "Utilities.h"
+
+#include <pthread.h>
+
+#include <cstring>
+#include <iostream>
+
 namespace ChimeraTK {
 
+  namespace {
+    // Parse an optional integer parameter, throw ChimeraTK::logic_error if it is invalid or out of range
+    std::optional<int> parseIntParameter(
+        const std::map<std::string, std::string>& parameters, const std::string& name, int min, int max) {
+      auto it = parameters.find(name);
+      if(it == parameters.end()) {
+        return std::nullopt;
+      }
+      return static_cast<int>(Utilities::parseIntegerParameter(name, it->second, min, max));
+    }
+  } // namespace
+
   UioBackend::UioBackend(std::string deviceName, std::string mapFileName) : NumericAddressedBackend(mapFileName) {
     _uioAccess = std::shared_ptr<UioAccess>(new UioAccess("/dev/" + deviceName));
   }
@@ -18,7 +37,20 @@ namespace ChimeraTK {
     if(address.size() == 0) {
       throw ChimeraTK::logic_error("UIO: Device name not specified.");
     }
-    return boost::shared_ptr<DeviceBackend>(new UioBackend(address, parameters["map"]));
+    auto backend = boost::shared_ptr<UioBackend>(new UioBackend(address, parameters["map"]));
+    backend->applyCommonParameters(parameters);
+
+    auto spinTime = parseIntParameter(parameters, "interruptSpinTime", 0, maxInterruptSpinTime);
+    if(spinTime) {
+      backend->_uioAccess->setSpinTime(std::chrono::microseconds(*spinTime));
+    }
+    backend->_interruptCpu = parseIntParameter(parameters, "interruptCpu", 0, CPU_SETSIZE - 1);
+    backend->_interruptPriority = parseIntParameter(parameters, "interruptPriority", 1, 99);
+    if(spinTime && *spinTime > 0 && backend->_interruptPriority) {
+      // A spinning SCHED_FIFO thread would starve all normal threads on its CPU.
+      throw ChimeraTK::logic_error("UIO: Parameters 'interruptSpinTime' and 'interruptPriority' cannot be combined.");
+    }
+    return backend;
   }
 
   void UioBackend::open() {
@@ -93,7 +125,31 @@ namespace ChimeraTK {
     return result;
   }
 
+  void UioBackend::configureInterruptThread() {
+    if(_interruptCpu) {
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      CPU_SET(*_interruptCpu, &cpuSet);
+      int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+      if(ret != 0) {
+        std::cerr << "UIO: Cannot pin interrupt thread to CPU " << *_interruptCpu << ": " << std::strerror(ret)
+                  << std::endl;
+      }
+    }
+    if(_interruptPriority) {
+      sched_param param{};
+      param.sched_priority = *_interruptPriority;
+      int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+      if(ret != 0) {
+        std::cerr << "UIO: Cannot set SCHED_FIFO priority " << *_interruptPriority
+                  << " for interrupt thread: " << std::strerror(ret) << std::endl;
+      }
+    }
+  }
+
   void UioBackend::waitForInterruptLoop(std::promise<void> subscriptionDonePromise) {
+    configureInterruptThread();
+
     try { // also the scope for the promiseFulfiller
 
       // The NumericAddressedBackend is waiting for subscription done to be fulfilled, so it can continue with
@@ -135,7 +191,8 @@ namespace ChimeraTK {
           }
           std::cout << "dispatching interrupt " << std::endl;
 #endif
-          dispatchInterrupt(0);
+          // The UIO driver only counts interrupts, so all of them are handled in a single distribution.
+          dispatchInterrupt(0, numberOfInterrupts);
         }
       }
       catch(ChimeraTK::runtime_error& ex) {
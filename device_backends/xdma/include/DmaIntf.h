@@ -3,6 +3,7 @@
 #pragma once
 
 #include "DeviceFile.h"
+#include "IoUring.h"
 #include "XdmaIntfAbstract.h"
 
 #include <string>
@@ -22,6 +23,11 @@ namespace ChimeraTK {
 
     void read(uintptr_t address, int32_t* __restrict__ buf, size_t nbytes) override;
     void write(uintptr_t address, const int32_t* data, size_t nbytes) override;
+
+    /// Return the transfer for detail::IoUring which does the same as read()
+    detail::FileTransfer makeReadTransfer(uintptr_t address, int32_t* buf, size_t nbytes) const;
+    /// Throw like read() if the executed transfer has not read all bytes
+    static void checkReadTransfer(const detail::FileTransfer& transfer);
   };
 
 } // namespace ChimeraTK
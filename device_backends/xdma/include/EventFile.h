@@ -13,7 +13,8 @@
 #include <thread>
 
 namespace ChimeraTK {
-  using EventCallback = std::function<void()>;
+  /** Called with the number of interrupts to be dispatched */
+  using EventCallback = std::function<void(uint32_t nInterrupts)>;
 
   class EventFile;
   class EventThread {
@@ -41,12 +42,15 @@ namespace ChimeraTK {
     friend class EventThread;
     DeviceFile _file;
     EventCallback _callback;
+    bool _coalesce;
 
     std::unique_ptr<EventThread> _evtThread;
 
    public:
     EventFile() = delete;
-    EventFile(const std::string& devicePath, size_t interruptIdx, EventCallback callback);
+    /** If coalesce is set, all interrupts counted by the driver in one event are reported to the callback in a single
+     *  call. Otherwise the callback is called once per interrupt. */
+    EventFile(const std::string& devicePath, size_t interruptIdx, EventCallback callback, bool coalesce = false);
     // EventFile(EventFile&& d) = default;
     ~EventFile();
 
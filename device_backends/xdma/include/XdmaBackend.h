@@ -5,11 +5,16 @@
 #include "CtrlIntf.h"
 #include "DmaIntf.h"
 #include "EventFile.h"
+#include "IoUring.h"
 #include "NumericAddressedBackend.h"
+#include "ThreadPool.h"
 
 #include <boost/core/noncopyable.hpp>
 
 #include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -19,6 +24,7 @@ namespace ChimeraTK {
    private:
     static constexpr size_t _maxDmaChannels = 4;
     static constexpr size_t _maxInterrupts = 16;
+    static constexpr size_t _maxDmaStripeSize = 256 * 1024 * 1024;
 
     std::optional<CtrlIntf> _ctrlIntf;
     std::vector<DmaIntf> _dmaChannels;
@@ -26,8 +32,56 @@ namespace ChimeraTK {
 
     const std::string _devicePath;
 
+    /// merge all interrupts counted by the driver in one event into a single distribution
+    bool _interruptCoalescing{false};
+
+    /// Minimum size in bytes of the piece of a DMA transfer executed by one channel. 0 disables striping.
+    size_t _dmaStripeSize{0};
+
+    /// One thread for each DMA channel beyond the first, only present if striping is enabled and possible
+    std::unique_ptr<ThreadPool> _stripingPool;
+
+    /// submit the DMA reads of readMultiple() through io_uring
+    bool _useIoUring{false};
+    std::unique_ptr<detail::IoUring> _ioUring;
+
     XdmaIntfAbstract& _intfFromBar(uint64_t bar);
 
+    /// The DMA channel of the given bar (13 and above)
+    DmaIntf& _dmaChannelFromBar(uint64_t bar);
+
+    /// A part of a DMA transfer executed by one channel. The offset is relative to the start of the transfer.
+    struct DmaPiece {
+      DmaIntf& channel;
+      size_t offset;
+      size_t nBytes;
+    };
+
+    /**
+     * Split a DMA transfer on the given bar (13 and above) into whole stripes for the individual channels, and append
+     * the pieces to the given list. The first piece goes to the channel of the bar. Without striping, or if the
+     * transfer is not larger than one stripe, this is a single piece.
+     */
+    void _dmaPieces(uint64_t bar, size_t sizeInBytes, std::vector<DmaPiece>& pieces);
+
+    /// Storage for readMultiple(), kept to avoid allocations for each call. Protected by _readMultipleMutex.
+    std::mutex _readMultipleMutex;
+    std::vector<detail::FileTransfer> _readMultipleTransfers;
+    std::vector<ReadRequest*> _requestOfTransfer;
+    std::vector<DmaPiece> _readMultiplePieces;
+
+    /**
+     * Storage for striped transfers in _dmaTransfer(), kept to avoid allocations for each call. Each task transfers the
+     * piece with the same index by calling _stripedTransfer. Protected by _stripingMutex.
+     */
+    std::mutex _stripingMutex;
+    std::vector<DmaPiece> _stripedPieces;
+    std::vector<std::function<void()>> _stripedTasks;
+    const std::function<void(DmaIntf&, size_t, size_t)>* _stripedTransfer{nullptr};
+
+    /** Call transfer(channel, offset, nBytes) for all pieces of a DMA transfer, concurrently if there are several. */
+    void _dmaTransfer(uint64_t bar, size_t sizeInBytes, const std::function<void(DmaIntf&, size_t, size_t)>& transfer);
+
    public:
     explicit XdmaBackend(std::string devicePath, std::string mapFileName = "");
     ~XdmaBackend() override;
@@ -39,11 +93,30 @@ namespace ChimeraTK {
     void dump(const int32_t* data, size_t nbytes);
     void read(uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) override;
     void write(uint64_t bar, uint64_t address, const int32_t* data, size_t sizeInBytes) override;
+    void readMultiple(std::vector<ReadRequest>& requests) override;
     std::future<void> activateSubscription(uint32_t interruptNumber) override;
     using NumericAddressedBackend::dispatchInterrupt; // make public for EventThread
 
     std::string readDeviceInfo() override;
 
+    /* The address is the device directory relative to /dev, or an absolute path. The latter allows to use a
+     * directory of regular files instead of the device nodes, e.g. for testing DMA transfers.
+     *
+     * Supported parameters are "map" (map file name), "interruptCoalescing" (0 or 1, default 0: if 1, interrupts
+     * which have piled up in the driver are dispatched in a single distribution instead of one distribution each, see
+     * AsyncNDRegisterAccessor::getNumberOfCoalescedInterrupts()), "dmaStripeSize", "ioUring" and the parameters
+     * handled by NumericAddressedBackend::applyCommonParameters().
+     *
+     * "dmaStripeSize" (bytes, multiple of 4 up to 256 MiB, default 0 = disabled) enables striped DMA transfers: DMA
+     * transfers larger than one stripe are split into up to one piece of whole stripes per c2h/h2c channel, and the
+     * pieces are transferred concurrently. This requires that all DMA channels access the same address space, which
+     * is the case for the memory mapped AXI interface of the XDMA core. Which channel transfers which piece is not
+     * defined, so the bars 13 and above must not be used for different address spaces in this mode. If the transfer is
+     * issued from a thread of a ThreadPool (e.g. by a TransferGroup with parallel transfers), it is not striped.
+     *
+     * "ioUring" (0 or 1, default 0) submits the DMA reads of a TransferGroup (see
+     * NumericAddressedBackend::readMultiple()) at once through io_uring, so they are queued to the driver together.
+     * If io_uring is not available, the reads are executed one after another with pread(). */
     static boost::shared_ptr<DeviceBackend> createInstance(
         std::string address, std::map<std::string, std::string> parameters);
   };
@@ -6,6 +6,7 @@
 #include "DeviceFile.h"
 #include "Exception.h"
 
+#include <cstring>
 #include <fcntl.h>
 
 namespace ChimeraTK {
@@ -24,6 +25,20 @@ namespace ChimeraTK {
     }
   }
 
+  detail::FileTransfer DmaIntf::makeReadTransfer(uintptr_t address, int32_t* buf, size_t nbytes) const {
+    return {_c2h, false, buf, nbytes, address};
+  }
+
+  void DmaIntf::checkReadTransfer(const detail::FileTransfer& transfer) {
+    if(transfer.result < 0) {
+      throw(ChimeraTK::runtime_error("DmaIntf read failed: " + std::string(std::strerror(int(-transfer.result)))));
+    }
+    if(transfer.result != static_cast<ssize_t>(transfer.nBytes)) {
+      throw(ChimeraTK::runtime_error("DmaIntf read size mismatch: read " + std::to_string(transfer.result) +
+          " bytes, expected " + std::to_string(transfer.nBytes)));
+    }
+  }
+
   void DmaIntf::write(uintptr_t address, const int32_t* data, size_t nbytes) {
     ssize_t result = ::pwrite(_h2c, data, nbytes, address);
     if(result != static_cast<ssize_t>(nbytes)) {
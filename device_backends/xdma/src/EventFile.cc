@@ -78,14 +78,22 @@ namespace ChimeraTK {
     std::cout << "XDMA: Event " << _owner._file.name() << " received: " << bytes_transferred << " bytes, "
               << numInterrupts << " interrupts\n";
 #endif
-    while(numInterrupts--) {
-      _owner._callback();
+    if(_owner._coalesce) {
+      // The interrupts which piled up while the previous event was processed are handled in a single distribution.
+      if(numInterrupts > 0) {
+        _owner._callback(numInterrupts);
+      }
+    }
+    else {
+      while(numInterrupts--) {
+        _owner._callback(1);
+      }
     }
     waitForEvent();
   }
 
-  EventFile::EventFile(const std::string& devicePath, size_t interruptIdx, EventCallback callback)
-  : _file{devicePath + "/events" + std::to_string(interruptIdx), O_RDONLY}, _callback{callback} {}
+  EventFile::EventFile(const std::string& devicePath, size_t interruptIdx, EventCallback callback, bool coalesce)
+  : _file{devicePath + "/events" + std::to_string(interruptIdx), O_RDONLY}, _callback{callback}, _coalesce{coalesce} {}
 
   EventFile::~EventFile() {
     _evtThread.reset(nullptr);
@@ -3,8 +3,11 @@
 
 #include "XdmaBackend.h"
 
+#include "Utilities.h"
+
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iomanip>
 
@@ -39,6 +42,19 @@ namespace ChimeraTK {
       }
     }
 
+    // Threads for the additional channels of striped transfers. Keep the pool over a reopen with the same channels.
+    if(_dmaStripeSize > 0 && _dmaChannels.size() > 1) {
+      if(!_stripingPool || _stripingPool->size() != _dmaChannels.size() - 1) {
+        _stripingPool = std::make_unique<ThreadPool>(_dmaChannels.size() - 1);
+      }
+    }
+    else {
+      _stripingPool.reset();
+    }
+    if(_useIoUring && !_ioUring) {
+      _ioUring = std::make_unique<detail::IoUring>();
+    }
+
 #ifdef _DEBUG
     std::cout << "XDMA: opened interface with " << _dmaChannels.size() << " DMA channels and " << _eventFiles.size()
               << " interrupt sources\n";
@@ -71,6 +87,58 @@ namespace ChimeraTK {
     throw ChimeraTK::logic_error("Couldn't find XDMA channel for BAR value " + std::to_string(bar));
   }
 
+  DmaIntf& XdmaBackend::_dmaChannelFromBar(uint64_t bar) {
+    if(bar < 13 || bar - 13 >= _dmaChannels.size()) {
+      throw ChimeraTK::logic_error("Couldn't find XDMA channel for BAR value " + std::to_string(bar));
+    }
+    return _dmaChannels[bar - 13];
+  }
+
+  void XdmaBackend::_dmaPieces(uint64_t bar, size_t sizeInBytes, std::vector<DmaPiece>& pieces) {
+    auto& firstChannelIntf = _dmaChannelFromBar(bar);
+    if(!_stripingPool || sizeInBytes <= _dmaStripeSize) {
+      pieces.push_back({firstChannelIntf, 0, sizeInBytes});
+      return;
+    }
+    const size_t nChannels = _dmaChannels.size();
+    const size_t firstChannel = bar - 13;
+
+    // distribute the stripes evenly, so all pieces but the last have the same size
+    const size_t nStripes = (sizeInBytes + _dmaStripeSize - 1) / _dmaStripeSize;
+    const size_t pieceSize = ((nStripes + nChannels - 1) / nChannels) * _dmaStripeSize;
+
+    for(size_t offset = 0, i = 0; offset < sizeInBytes; offset += pieceSize, ++i) {
+      auto& channel = _dmaChannels[(firstChannel + i) % nChannels];
+      pieces.push_back({channel, offset, std::min(pieceSize, sizeInBytes - offset)});
+    }
+  }
+
+  void XdmaBackend::_dmaTransfer(
+      uint64_t bar, size_t sizeInBytes, const std::function<void(DmaIntf&, size_t, size_t)>& transfer) {
+    // A worker thread of a ThreadPool would execute the pieces one after another (see ThreadPool::runAll()), so the
+    // transfer is not striped in that case.
+    if(!_stripingPool || sizeInBytes <= _dmaStripeSize || ThreadPool::isWorkerThread()) {
+      transfer(_dmaChannelFromBar(bar), 0, sizeInBytes);
+      return;
+    }
+
+    // A striped transfer uses all channels, so concurrent striped transfers would only compete for them.
+    std::lock_guard<std::mutex> lock(_stripingMutex);
+    _stripedPieces.clear();
+    _dmaPieces(bar, sizeInBytes, _stripedPieces);
+    _stripedTransfer = &transfer;
+    if(_stripedTasks.size() != _stripedPieces.size()) {
+      _stripedTasks.clear();
+      for(size_t i = 0; i < _stripedPieces.size(); ++i) {
+        _stripedTasks.emplace_back([this, i] {
+          const auto& piece = _stripedPieces[i];
+          (*_stripedTransfer)(piece.channel, piece.offset, piece.nBytes);
+        });
+      }
+    }
+    _stripingPool->runAll(_stripedTasks);
+  }
+
 #ifdef _DEBUG
   void XdmaBackend::dump(const int32_t* data, size_t nbytes) {
     constexpr size_t wordsPerLine = 8;
@@ -94,8 +162,15 @@ namespace ChimeraTK {
 #ifdef _DEBUGDUMP
     std::cout << "XDMA: read " << sizeInBytes << " bytes @ BAR" << bar << ", 0x" << std::hex << address << std::endl;
 #endif
-    auto& intf = _intfFromBar(bar);
-    intf.read(address, data, sizeInBytes);
+    if(bar >= 13) {
+      _dmaTransfer(bar, sizeInBytes, [&](DmaIntf& channel, size_t offset, size_t nBytes) {
+        channel.read(address + offset, data + offset / sizeof(int32_t), nBytes);
+      });
+    }
+    else {
+      auto& intf = _intfFromBar(bar);
+      intf.read(address, data, sizeInBytes);
+    }
 #ifdef _DEBUGDUMP
     dump(data, sizeInBytes);
 #endif
@@ -105,13 +180,68 @@ namespace ChimeraTK {
 #ifdef _DEBUGDUMP
     std::cout << "XDMA: write " << sizeInBytes << " bytes @ BAR" << bar << ", 0x" << std::hex << address << std::endl;
 #endif
-    auto& intf = _intfFromBar(bar);
-    intf.write(address, data, sizeInBytes);
+    if(bar >= 13) {
+      _dmaTransfer(bar, sizeInBytes, [&](DmaIntf& channel, size_t offset, size_t nBytes) {
+        channel.write(address + offset, data + offset / sizeof(int32_t), nBytes);
+      });
+    }
+    else {
+      auto& intf = _intfFromBar(bar);
+      intf.write(address, data, sizeInBytes);
+    }
 #ifdef _DEBUGDUMP
     dump(data, sizeInBytes);
 #endif
   }
 
+  void XdmaBackend::readMultiple(std::vector<ReadRequest>& requests) {
+    checkActiveException();
+    if(!_ioUring) {
+      NumericAddressedBackend::readMultiple(requests);
+      return;
+    }
+
+    // The DMA reads of all requests, including all pieces of striped reads, are submitted at once. Reads from the
+    // control interface are memory mapped and executed directly.
+    std::lock_guard<std::mutex> lock(_readMultipleMutex);
+    auto& transfers = _readMultipleTransfers;
+    auto& requestOfTransfer = _requestOfTransfer;
+    transfers.clear();
+    requestOfTransfer.clear();
+    for(auto& request : requests) {
+      if(request.bar < 13) {
+        try {
+          read(request.bar, request.address, request.data, request.sizeInBytes);
+        }
+        catch(ChimeraTK::runtime_error&) {
+          request.error = std::current_exception();
+        }
+        continue;
+      }
+      _readMultiplePieces.clear();
+      _dmaPieces(request.bar, request.sizeInBytes, _readMultiplePieces);
+      for(const auto& piece : _readMultiplePieces) {
+        transfers.push_back(piece.channel.makeReadTransfer(
+            request.address + piece.offset, request.data + piece.offset / sizeof(int32_t), piece.nBytes));
+        requestOfTransfer.push_back(&request);
+      }
+    }
+
+    _ioUring->execute(transfers);
+
+    for(size_t i = 0; i < transfers.size(); ++i) {
+      auto& request = *requestOfTransfer[i];
+      try {
+        DmaIntf::checkReadTransfer(transfers[i]);
+      }
+      catch(ChimeraTK::runtime_error&) {
+        if(!request.error) {
+          request.error = std::current_exception();
+        }
+      }
+    }
+  }
+
   std::future<void> XdmaBackend::activateSubscription(uint32_t interruptNumber) {
     std::promise<void> subscriptionDonePromise;
     auto subscriptionDoneFuture = subscriptionDonePromise.get_future();
@@ -124,7 +254,11 @@ namespace ChimeraTK {
 
     if(!_eventFiles[interruptNumber]) {
       _eventFiles[interruptNumber] = std::make_unique<EventFile>(
-          _devicePath, interruptNumber, [&]() { XdmaBackend::dispatchInterrupt(interruptNumber); });
+          _devicePath, interruptNumber,
+          [this, interruptNumber](uint32_t nInterrupts) {
+            XdmaBackend::dispatchInterrupt(interruptNumber, nInterrupts);
+          },
+          _interruptCoalescing);
       _eventFiles[interruptNumber]->startThread(std::move(subscriptionDonePromise));
     }
     else {
@@ -153,7 +287,37 @@ namespace ChimeraTK {
       throw ChimeraTK::logic_error("XDMA device address not specified.");
     }
 
-    return boost::make_shared<XdmaBackend>("/dev/" + address, parameters["map"]);
+    // absolute paths are used as they are, e.g. for a directory of regular files replacing the device nodes
+    auto devicePath = (address.front() == '/') ? address : "/dev/" + address;
+    auto backend = boost::make_shared<XdmaBackend>(devicePath, parameters["map"]);
+    backend->applyCommonParameters(parameters);
+
+    auto it = parameters.find("interruptCoalescing");
+    if(it != parameters.end()) {
+      if(it->second != "0" && it->second != "1") {
+        throw ChimeraTK::logic_error(
+            "Invalid value for parameter 'interruptCoalescing' (must be 0 or 1): '" + it->second + "'");
+      }
+      backend->_interruptCoalescing = (it->second == "1");
+    }
+
+    it = parameters.find("ioUring");
+    if(it != parameters.end()) {
+      if(it->second != "0" && it->second != "1") {
+        throw ChimeraTK::logic_error("Invalid value for parameter 'ioUring' (must be 0 or 1): '" + it->second + "'");
+      }
+      backend->_useIoUring = (it->second == "1");
+    }
+
+    it = parameters.find("dmaStripeSize");
+    if(it != parameters.end()) {
+      backend->_dmaStripeSize = Utilities::parseIntegerParameter("dmaStripeSize", it->second, 0, _maxDmaStripeSize);
+      if(backend->_dmaStripeSize % sizeof(int32_t) != 0) {
+        throw ChimeraTK::logic_error(
+            "Invalid value for parameter 'dmaStripeSize' (must be a multiple of 4): '" + it->second + "'");
+      }
+    }
+    return backend;
   }
 
 } // namespace ChimeraTK
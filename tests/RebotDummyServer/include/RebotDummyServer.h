@@ -8,7 +8,9 @@
 #include <boost/asio.hpp>
 
 #include <atomic>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace ip = boost::asio::ip;
@@ -34,11 +36,15 @@ namespace ChimeraTK {
     // server itself
 
     static const int BUFFER_SIZE_IN_WORDS = 256;
+    // all requests start with a header of three words (command, address, number of words / parameter)
+    static const int REQUEST_SIZE_IN_WORDS = 3;
     static const int32_t READ_SUCCESS_INDICATION = 1000;
     static const int32_t WRITE_SUCCESS_INDICATION = 1001;
     static const uint32_t PONG = 1005;
     static const int32_t TOO_MUCH_DATA_REQUESTED = -1010;
     static const int32_t UNKNOWN_INSTRUCTION = -1040;
+    // answer to requests rejected through _rejectedWordAddress
+    static const int32_t REQUEST_REJECTED = -1050;
 
     static const uint32_t SINGLE_WORD_WRITE = 1;
     static const uint32_t MULTI_WORD_WRITE = 2;
@@ -59,8 +65,17 @@ namespace ChimeraTK {
     std::atomic<uint32_t> _helloCount; // in protocol version 1 we have to send
                                        // hello instead of heartbeat
     std::atomic<bool> _dont_answer;    // flag to cause an error condition
+    // number of received read and single word write requests, e.g. to check into how many requests a transfer has
+    // been split
+    std::atomic<uint32_t> _multiWordReadCount{0};
+    std::atomic<uint32_t> _singleWordWriteCount{0};
+    // read and single word write requests for this word address are answered with REQUEST_REJECTED and not executed
+    // (-1: reject nothing)
+    std::atomic<int64_t> _rejectedWordAddress{-1};
     std::shared_ptr<DummyBackend> _registerSpace;
     std::vector<uint32_t> _dataBuffer;
+    // received words which do not form a complete request yet
+    std::vector<uint32_t> _receivedWords;
 
     unsigned int _serverPort;
     unsigned int _protocolVersion;
@@ -68,6 +83,7 @@ namespace ChimeraTK {
     std::unique_ptr<DummyProtocolImplementor> _protocolImplementor;
 
     void processReceivedPackage(std::vector<uint32_t>& buffer);
+    bool isRejected(const std::vector<uint32_t>& request) const;
     void writeWordToRequestedAddress(std::vector<uint32_t>& buffer);
     void readRegisterAndSendData(std::vector<uint32_t>& buffer);
 
@@ -81,7 +97,9 @@ namespace ChimeraTK {
 
   class RebotDummyServer {
    public:
-    RebotDummyServer(unsigned int portNumber, std::string mapFile, unsigned int protocolVersion);
+    // By default only one client connection is accepted at a time, further connections are refused
+    RebotDummyServer(
+        unsigned int portNumber, std::string mapFile, unsigned int protocolVersion, size_t maxSessions = 1);
 
     void start();
     void stop();
@@ -89,14 +107,20 @@ namespace ChimeraTK {
     unsigned int port() const { return _connectionAcceptor.local_endpoint().port(); }
 
     boost::asio::io_service& service() { return _io; }
-    std::shared_ptr<RebotDummySession> session() { return _currentSession.lock(); }
+    // the oldest open session
+    std::shared_ptr<RebotDummySession> session();
+    size_t nSessions();
 
    private:
     void do_accept();
+    // remove sessions which have been closed. Must be called with the _sessionsMutex held.
+    void removeClosedSessions();
     unsigned int _protocolVersion;
+    size_t _maxSessions;
     boost::asio::io_service _io;
     ip::tcp::acceptor _connectionAcceptor;
-    std::weak_ptr<RebotDummySession> _currentSession;
+    std::mutex _sessionsMutex;
+    std::list<std::weak_ptr<RebotDummySession>> _sessions;
     ip::tcp::socket _socket;
     std::shared_ptr<DummyBackend> _registerSpace;
   };
@@ -42,11 +42,13 @@ namespace ChimeraTK {
     buffer.reset(new std::vector<uint32_t>(RebotDummySession::BUFFER_SIZE_IN_WORDS));
 
     _currentClientConnection.async_read_some(
-        boost::asio::buffer(*buffer), [this, self, buffer](boost::system::error_code ec, std::size_t) {
+        boost::asio::buffer(*buffer), [this, self, buffer](boost::system::error_code ec, std::size_t nBytes) {
           if(ec) {
             _currentClientConnection.close();
           }
           else {
+            // only pass on what has actually been received
+            buffer->resize(nBytes / sizeof(uint32_t));
             processReceivedPackage(*buffer);
           }
         });
@@ -59,8 +61,9 @@ namespace ChimeraTK {
     }
 
     auto self(shared_from_this());
-    _currentClientConnection.async_write_some(
-        boost::asio::buffer(_dataBuffer), [this, self](boost::system::error_code ec, std::size_t) {
+    // The answers to several pipelined requests can be large. async_write() sends all of it, unlike async_write_some().
+    boost::asio::async_write(_currentClientConnection, boost::asio::buffer(_dataBuffer),
+        [this, self](boost::system::error_code ec, std::size_t) {
           if(not ec) {
             _dataBuffer.clear();
           }
@@ -87,35 +90,69 @@ namespace ChimeraTK {
       return;
     }
 
-    uint32_t requestedAction = buffer.at(0);
-    switch(requestedAction) {
-      case SINGLE_WORD_WRITE:
-        _protocolImplementor->singleWordWrite(buffer);
-        break;
-      case MULTI_WORD_WRITE:
-        _state = _protocolImplementor->multiWordWrite(buffer);
-        break;
-      case MULTI_WORD_READ:
-        _protocolImplementor->multiWordRead(buffer);
-        break;
-      case HELLO:
-        ++_helloCount;
-        _protocolImplementor->hello(buffer);
-        break;
-      case PING:
-        ++_heartbeatCount;
-        _protocolImplementor->ping(buffer);
-        break;
-      default:
-        std::cout << "Instruction unknown in all protocol versions " << requestedAction << std::endl;
-        sendSingleWord(UNKNOWN_INSTRUCTION);
+    // A pipelining client sends several requests without waiting for the answers, so one package can contain more than
+    // one request, and a request can be split over two packages. Collect the received words and process all complete
+    // requests in order.
+    _receivedWords.insert(_receivedWords.end(), buffer.begin(), buffer.end());
+    auto next = _receivedWords.begin();
+    while(_state == ACCEPT_NEW_COMMAND && _receivedWords.end() - next >= REQUEST_SIZE_IN_WORDS) {
+      std::vector<uint32_t> request(next, next + REQUEST_SIZE_IN_WORDS);
+      next += REQUEST_SIZE_IN_WORDS;
+
+      uint32_t requestedAction = request.at(0);
+      switch(requestedAction) {
+        case SINGLE_WORD_WRITE:
+          ++_singleWordWriteCount;
+          if(isRejected(request)) {
+            sendSingleWord(REQUEST_REJECTED);
+          }
+          else {
+            _protocolImplementor->singleWordWrite(request);
+          }
+          break;
+        case MULTI_WORD_WRITE:
+          // The data follows the request header and can span several packages. Everything received belongs to it.
+          request.insert(request.end(), next, _receivedWords.end());
+          next = _receivedWords.end();
+          _state = _protocolImplementor->multiWordWrite(request);
+          break;
+        case MULTI_WORD_READ:
+          ++_multiWordReadCount;
+          if(isRejected(request)) {
+            sendSingleWord(REQUEST_REJECTED);
+          }
+          else {
+            _protocolImplementor->multiWordRead(request);
+          }
+          break;
+        case HELLO:
+          ++_helloCount;
+          _protocolImplementor->hello(request);
+          break;
+        case PING:
+          ++_heartbeatCount;
+          _protocolImplementor->ping(request);
+          break;
+        default:
+          std::cout << "Instruction unknown in all protocol versions " << requestedAction << std::endl;
+          sendSingleWord(UNKNOWN_INSTRUCTION);
+          // We cannot know where the next request starts. Discard the rest.
+          next = _receivedWords.end();
+      }
     }
+    _receivedWords.erase(_receivedWords.begin(), next);
 
     doWrite();
   }
 
   /********************************************************************************************************************/
 
+  bool RebotDummySession::isRejected(const std::vector<uint32_t>& request) const {
+    return _rejectedWordAddress == static_cast<int64_t>(request.at(1));
+  }
+
+  /********************************************************************************************************************/
+
   void RebotDummySession::writeWordToRequestedAddress(std::vector<uint32_t>& buffer) {
     // byte and address must be uint64_t (uint8_t/uint32_t combination not allowed in DummyBackend any more)
     uint64_t registerAddress = buffer.at(1); // This is the word offset; since
@@ -169,9 +206,11 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
-  RebotDummyServer::RebotDummyServer(unsigned int portNumber, std::string mapFile, unsigned int protocolVersion)
-  : _protocolVersion(protocolVersion), _io(), _connectionAcceptor(_io, ip::tcp::endpoint(ip::tcp::v4(), portNumber)),
-    _socket(_io), _registerSpace(std::make_shared<DummyBackend>(mapFile)) {
+  RebotDummyServer::RebotDummyServer(
+      unsigned int portNumber, std::string mapFile, unsigned int protocolVersion, size_t maxSessions)
+  : _protocolVersion(protocolVersion), _maxSessions(maxSessions), _io(),
+    _connectionAcceptor(_io, ip::tcp::endpoint(ip::tcp::v4(), portNumber)), _socket(_io),
+    _registerSpace(std::make_shared<DummyBackend>(mapFile)) {
     // The first address of the register space is set to a reference value. This
     // would be used to test the rebot client.
     uint64_t registerAddress = 0x04;
@@ -185,9 +224,12 @@ namespace ChimeraTK {
   void RebotDummyServer::do_accept() {
     _connectionAcceptor.async_accept(_socket, [this](boost::system::error_code ec) {
       if(not ec) {
-        if(_currentSession.expired()) {
+        std::unique_lock<std::mutex> lock(_sessionsMutex);
+        removeClosedSessions();
+        if(_sessions.size() < _maxSessions) {
           auto newSession = std::make_shared<RebotDummySession>(_protocolVersion, std::move(_socket), _registerSpace);
-          _currentSession = newSession;
+          _sessions.push_back(newSession);
+          lock.unlock();
           newSession->start();
         }
         else {
@@ -199,6 +241,25 @@ namespace ChimeraTK {
     });
   }
 
+  void RebotDummyServer::removeClosedSessions() {
+    _sessions.remove_if([](const auto& session) { return session.expired(); });
+  }
+
+  std::shared_ptr<RebotDummySession> RebotDummyServer::session() {
+    std::lock_guard<std::mutex> lock(_sessionsMutex);
+    removeClosedSessions();
+    if(_sessions.empty()) {
+      return {};
+    }
+    return _sessions.front().lock();
+  }
+
+  size_t RebotDummyServer::nSessions() {
+    std::lock_guard<std::mutex> lock(_sessionsMutex);
+    removeClosedSessions();
+    return _sessions.size();
+  }
+
   void RebotDummyServer::start() {
     do_accept();
     _io.run();
@@ -0,0 +1,24 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <string>
+
+/*
+ * Device descriptors used by all benchmarks. Each benchmark is registered once per backend with BENCHMARK_CAPTURE(),
+ * using the names below as suffix, so the results of different backends can be compared directly.
+ */
+namespace benchmarkDevices {
+
+  /// DummyBackend: pure in-process memory, shows the overhead of the accessor implementation itself
+  inline const std::string dummy{"(dummy?map=performanceTest.map)"};
+
+  /// SharedDummyBackend: shared memory with inter-process locking
+  inline const std::string sharedDummy{"(sharedMemoryDummy:benchmark?map=performanceTest.map)"};
+
+  /// LogicalNameMappingBackend on top of the given target device
+  inline std::string logicalNameMap(const std::string& target) {
+    return "(logicalNameMap?map=benchmark.xlmap&target=" + target + ")";
+  }
+
+} // namespace benchmarkDevices
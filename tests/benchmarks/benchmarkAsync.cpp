@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmarks for the distribution of interrupts to accessors with AccessMode::wait_for_new_data.
+ */
+
+#include "BenchmarkDevices.h"
+#include "Device.h"
+#include "DummyBackendBase.h"
+#include "Exception.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+/*
+ * Latency from triggering the interrupt until the data has been received by state.range(0) subscribers of the same
+ * register (in the calling thread).
+ */
+static void BM_AsyncDistributionLatency(benchmark::State& state, const std::string& cdd) {
+  Device device(cdd);
+  device.open();
+  auto backend = boost::dynamic_pointer_cast<DummyBackendBase>(device.getBackend());
+  if(!backend) {
+    throw ChimeraTK::logic_error("Benchmark device '" + cdd + "' is not a dummy backend");
+  }
+
+  std::vector<OneDRegisterAccessor<int32_t>> accessors;
+  for(int64_t i = 0; i < state.range(0); ++i) {
+    accessors.push_back(device.getOneDRegisterAccessor<int32_t>("ASYNC/DATA", 0, 0, {AccessMode::wait_for_new_data}));
+  }
+  device.activateAsyncRead();
+
+  // consume the initial values
+  for(auto& acc : accessors) {
+    acc.read();
+  }
+
+  for([[maybe_unused]] auto _ : state) {
+    backend->triggerInterrupt(1);
+    for(auto& acc : accessors) {
+      acc.read();
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_AsyncDistributionLatency, dummy, benchmarkDevices::dummy)->Arg(1)->Arg(16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_AsyncDistributionLatency, sharedDummy, benchmarkDevices::sharedDummy)
+    ->Arg(1)
+    ->Arg(16)
+    ->UseRealTime();
+
+/**********************************************************************************************************************/
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmarks for the LogicalNameMappingBackend: plain redirection vs. a chain of accessor plugins (multiply, math,
+ * forceReadOnly), see benchmark.xlmap.
+ */
+
+#include "BenchmarkDevices.h"
+#include "Device.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+static void scalarRead(benchmark::State& state, const std::string& target, const std::string& registerName) {
+  Device device(benchmarkDevices::logicalNameMap(target));
+  device.open();
+  auto acc = device.getScalarRegisterAccessor<double>(registerName);
+  for([[maybe_unused]] auto _ : state) {
+    acc.read();
+    double value = acc;
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+static void BM_LNMScalarRead(benchmark::State& state, const std::string& target) {
+  scalarRead(state, target, "Scalar");
+}
+BENCHMARK_CAPTURE(BM_LNMScalarRead, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_LNMScalarRead, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_LNMScalarReadPluginChain(benchmark::State& state, const std::string& target) {
+  scalarRead(state, target, "ScalarWithPlugins");
+}
+BENCHMARK_CAPTURE(BM_LNMScalarReadPluginChain, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_LNMScalarReadPluginChain, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
+
+static void arrayRead(benchmark::State& state, const std::string& target, const std::string& registerName) {
+  Device device(benchmarkDevices::logicalNameMap(target));
+  device.open();
+  auto acc = device.getOneDRegisterAccessor<double>(registerName);
+  for([[maybe_unused]] auto _ : state) {
+    acc.read();
+    benchmark::DoNotOptimize(acc.data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(acc.getNElements()));
+}
+
+static void BM_LNMArrayRead(benchmark::State& state, const std::string& target) {
+  arrayRead(state, target, "Array");
+}
+BENCHMARK_CAPTURE(BM_LNMArrayRead, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_LNMArrayRead, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_LNMArrayReadPluginChain(benchmark::State& state, const std::string& target) {
+  arrayRead(state, target, "ArrayWithPlugins");
+}
+BENCHMARK_CAPTURE(BM_LNMArrayReadPluginChain, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_LNMArrayReadPluginChain, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
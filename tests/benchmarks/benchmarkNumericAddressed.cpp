@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmarks for the synchronous data paths of the NumericAddressedBackend: scalar, 1D and 2D (multiplexed) registers,
+ * raw vs. cooked, and merging of transfers in a TransferGroup.
+ */
+
+#include "BenchmarkDevices.h"
+#include "Device.h"
+#include "TransferGroup.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+template<typename UserType>
+static void scalarRead(benchmark::State& state, const std::string& cdd, const AccessModeFlags& flags) {
+  Device device(cdd);
+  device.open();
+  auto acc = device.getScalarRegisterAccessor<UserType>("BOARD/WORD_FIXPOINT", 0, flags);
+  for([[maybe_unused]] auto _ : state) {
+    acc.read();
+    UserType value = acc;
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+static void BM_ScalarReadCooked(benchmark::State& state, const std::string& cdd) {
+  scalarRead<double>(state, cdd, {});
+}
+BENCHMARK_CAPTURE(BM_ScalarReadCooked, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_ScalarReadCooked, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_ScalarReadRaw(benchmark::State& state, const std::string& cdd) {
+  scalarRead<int32_t>(state, cdd, {AccessMode::raw});
+}
+BENCHMARK_CAPTURE(BM_ScalarReadRaw, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_ScalarReadRaw, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
+
+static void BM_ScalarWriteCooked(benchmark::State& state, const std::string& cdd) {
+  Device device(cdd);
+  device.open();
+  auto acc = device.getScalarRegisterAccessor<double>("BOARD/WORD_FIXPOINT");
+  double value = 0;
+  for([[maybe_unused]] auto _ : state) {
+    acc = value;
+    acc.write();
+    value += 0.25;
+  }
+}
+BENCHMARK_CAPTURE(BM_ScalarWriteCooked, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_ScalarWriteCooked, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
+
+template<typename UserType>
+static void oneDRead(benchmark::State& state, const std::string& cdd, const AccessModeFlags& flags) {
+  Device device(cdd);
+  device.open();
+  auto acc = device.getOneDRegisterAccessor<UserType>("ADC/AREA_DMAABLE", 0, 0, flags);
+  for([[maybe_unused]] auto _ : state) {
+    acc.read();
+    benchmark::DoNotOptimize(acc.data());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(acc.getNElements() * sizeof(int32_t)));
+}
+
+static void BM_OneDReadCooked(benchmark::State& state, const std::string& cdd) {
+  oneDRead<double>(state, cdd, {});
+}
+BENCHMARK_CAPTURE(BM_OneDReadCooked, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_OneDReadCooked, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_OneDReadRaw(benchmark::State& state, const std::string& cdd) {
+  oneDRead<int32_t>(state, cdd, {AccessMode::raw});
+}
+BENCHMARK_CAPTURE(BM_OneDReadRaw, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_OneDReadRaw, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_OneDReadZeroCopy(benchmark::State& state, const std::string& cdd) {
+  oneDRead<int32_t>(state, cdd, {AccessMode::raw, AccessMode::zero_copy});
+}
+BENCHMARK_CAPTURE(BM_OneDReadZeroCopy, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_OneDReadZeroCopy, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
+
+template<typename UserType>
+static void oneDWrite(benchmark::State& state, const std::string& cdd, const AccessModeFlags& flags) {
+  Device device(cdd);
+  device.open();
+  auto acc = device.getOneDRegisterAccessor<UserType>("ADC/AREA_DMAABLE", 0, 0, flags);
+  for(size_t i = 0; i < acc.getNElements(); ++i) {
+    acc[i] = UserType(i % 1000);
+  }
+  for([[maybe_unused]] auto _ : state) {
+    acc.write();
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(acc.getNElements() * sizeof(int32_t)));
+}
+
+static void BM_OneDWriteCooked(benchmark::State& state, const std::string& cdd) {
+  oneDWrite<double>(state, cdd, {});
+}
+BENCHMARK_CAPTURE(BM_OneDWriteCooked, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_OneDWriteCooked, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_OneDWriteRaw(benchmark::State& state, const std::string& cdd) {
+  oneDWrite<int32_t>(state, cdd, {AccessMode::raw});
+}
+BENCHMARK_CAPTURE(BM_OneDWriteRaw, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_OneDWriteRaw, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
+
+template<typename UserType>
+static void twoDRead(benchmark::State& state, const std::string& cdd) {
+  Device device(cdd);
+  device.open();
+  auto acc = device.getTwoDRegisterAccessor<UserType>("ADC/DAQ");
+  for([[maybe_unused]] auto _ : state) {
+    acc.read();
+    benchmark::DoNotOptimize(acc[0].data());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(acc.getNChannels() * acc.getNElementsPerChannel()));
+}
+
+static void BM_TwoDReadDouble(benchmark::State& state, const std::string& cdd) {
+  twoDRead<double>(state, cdd);
+}
+BENCHMARK_CAPTURE(BM_TwoDReadDouble, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_TwoDReadDouble, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_TwoDReadInt32(benchmark::State& state, const std::string& cdd) {
+  twoDRead<int32_t>(state, cdd);
+}
+BENCHMARK_CAPTURE(BM_TwoDReadInt32, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_TwoDReadInt32, sharedDummy, benchmarkDevices::sharedDummy);
+
+static void BM_TwoDReadParallel(benchmark::State& state, const std::string& cdd) {
+  twoDRead<double>(state, cdd);
+}
+BENCHMARK_CAPTURE(
+    BM_TwoDReadParallel, dummy, std::string("(dummy?map=performanceTest.map&parallelConversion=16384)"));
+
+/**********************************************************************************************************************/
+
+static void BM_TwoDWrite(benchmark::State& state, const std::string& cdd) {
+  Device device(cdd);
+  device.open();
+  auto acc = device.getTwoDRegisterAccessor<double>("ADC/DAQ");
+  for([[maybe_unused]] auto _ : state) {
+    acc.write();
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(acc.getNChannels() * acc.getNElementsPerChannel()));
+}
+BENCHMARK_CAPTURE(BM_TwoDWrite, dummy, benchmarkDevices::dummy);
+BENCHMARK_CAPTURE(BM_TwoDWrite, sharedDummy, benchmarkDevices::sharedDummy);
+
+/**********************************************************************************************************************/
+
+/*
+ * Read state.range(0) scalar registers in neighbouring words. With state.range(1) != 0 they are read through a
+ * TransferGroup (which merges them into a single transfer), otherwise one by one.
+ */
+static void BM_ManyScalarsRead(benchmark::State& state, const std::string& cdd) {
+  Device device(cdd);
+  device.open();
+  auto nAccessors = size_t(state.range(0));
+  bool useGroup = state.range(1) != 0;
+
+  std::vector<ScalarRegisterAccessor<int32_t>> accessors;
+  TransferGroup group;
+  for(size_t i = 0; i < nAccessors; ++i) {
+    accessors.push_back(device.getScalarRegisterAccessor<int32_t>("ADC/AREA_DMAABLE", i));
+  }
+  if(useGroup) {
+    group.addAccessors(accessors);
+  }
+
+  for([[maybe_unused]] auto _ : state) {
+    if(useGroup) {
+      group.read();
+    }
+    else {
+      for(auto& acc : accessors) {
+        acc.read();
+      }
+    }
+    int32_t value = accessors.back();
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(nAccessors));
+}
+BENCHMARK_CAPTURE(BM_ManyScalarsRead, dummy, benchmarkDevices::dummy)
+    ->ArgsProduct({{16, 256}, {0, 1}})
+    ->ArgNames({"n", "group"});
+BENCHMARK_CAPTURE(BM_ManyScalarsRead, sharedDummy, benchmarkDevices::sharedDummy)
+    ->ArgsProduct({{16, 256}, {0, 1}})
+    ->ArgNames({"n", "group"});
+
+/**********************************************************************************************************************/
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+/*
+ * Benchmark for the wake-up latency of detail::pollWithSpin(), which is used by the UIO backend to wait for
+ * interrupts, with and without spinning before the blocking wait. A pipe is used instead of a UIO device file, so the
+ * result does not include the latency of the hardware and of the kernel driver.
+ */
+
+#ifdef CHIMERATK_HAVE_UIO_BACKEND
+
+#  include "Exception.h"
+#  include "UioAccess.h"
+
+#  include <benchmark/benchmark.h>
+#  include <unistd.h>
+
+#  include <atomic>
+#  include <cerrno>
+#  include <cstring>
+#  include <thread>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+/*
+ * Event on a pipe: like the UIO device file, the read end of the pipe becomes readable when an "interrupt" arrives and
+ * delivers the 32 bit interrupt counter.
+ */
+struct PipeEvent {
+  PipeEvent() {
+    if(pipe(fds) != 0) {
+      throw ChimeraTK::runtime_error(std::string("Cannot create pipe: ") + std::strerror(errno));
+    }
+  }
+  ~PipeEvent() {
+    close(fds[0]);
+    close(fds[1]);
+  }
+
+  void trigger() {
+    ++counter;
+    if(write(fds[1], &counter, sizeof(counter)) != sizeof(counter)) {
+      throw ChimeraTK::runtime_error(std::string("Cannot write to pipe: ") + std::strerror(errno));
+    }
+  }
+
+  // Wait like UioAccess::waitForInterrupt() and return whether the interrupt has arrived
+  bool wait(std::chrono::nanoseconds spinTime) {
+    if(detail::pollWithSpin(fds[0], 100, spinTime) != 1) {
+      return false;
+    }
+    uint32_t count;
+    return read(fds[0], &count, sizeof(count)) == sizeof(count);
+  }
+
+  int fds[2]{};
+  uint32_t counter{0};
+};
+
+/*
+ * Round trip between the benchmark thread and a simulated interrupt thread, which answers each event through a second
+ * pipe. Half of the round trip time is the wake-up latency of the interrupt thread. Both threads
+ * wait with the spin time state.range(0) in microseconds.
+ */
+static void BM_PollWithSpinWakeUp(benchmark::State& state) {
+  std::chrono::microseconds spinTime(state.range(0));
+  PipeEvent interrupt, answer;
+  std::atomic<bool> stop{false};
+
+  std::thread interruptThread([&] {
+    while(!stop) {
+      if(interrupt.wait(spinTime)) {
+        answer.trigger();
+      }
+    }
+  });
+
+  for([[maybe_unused]] auto _ : state) {
+    interrupt.trigger();
+    while(!answer.wait(spinTime)) {
+    }
+  }
+
+  stop = true;
+  interruptThread.join();
+  state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_PollWithSpinWakeUp)->Arg(0)->Arg(20)->Arg(100)->UseRealTime();
+
+/**********************************************************************************************************************/
+
+#endif // CHIMERATK_HAVE_UIO_BACKEND
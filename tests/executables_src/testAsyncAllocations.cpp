@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE AsyncAllocationsTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "DummyBackend.h"
+using namespace ChimeraTK;
+
+#include <cstdlib>
+#include <list>
+#include <new>
+
+/**********************************************************************************************************************/
+
+/*
+ * Count the heap allocations of the current thread while countAllocations is set. The dummy backend distributes
+ * interrupts synchronously in the thread calling triggerInterrupt(), so this covers the complete path from the
+ * interrupt to the data in the user buffer.
+ */
+namespace {
+  thread_local bool countAllocations{false};
+  thread_local size_t nAllocations{0};
+} // namespace
+
+void* operator new(std::size_t size) {
+  if(countAllocations) {
+    ++nAllocations;
+  }
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if(!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testNoAllocationPerInterrupt) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.open();
+  auto dummy = boost::dynamic_pointer_cast<DummyBackend>(device.getBackend());
+  BOOST_REQUIRE(dummy);
+  auto writeable = device.getScalarRegisterAccessor<int32_t>("MODULE0/INTERRUPT_TYPE/DUMMY_WRITEABLE");
+
+  // Several subscribers of the same register (one takes over the polled buffer, the others copy) and one with a
+  // different user type. Strings are not covered, the conversion to string allocates by itself.
+  std::list<ScalarRegisterAccessor<int32_t>> intSubscribers;
+  for(size_t i = 0; i < 3; ++i) {
+    intSubscribers.push_back(
+        device.getScalarRegisterAccessor<int32_t>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data}));
+  }
+  auto doubleSubscriber =
+      device.getScalarRegisterAccessor<double>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data});
+
+  device.activateAsyncRead();
+  for(auto& acc : intSubscribers) {
+    acc.read();
+  }
+  doubleSubscriber.read();
+
+  auto interruptAndRead = [&](int32_t value) {
+    writeable = value;
+    writeable.write();
+    countAllocations = true;
+    dummy->triggerInterrupt(6);
+    for(auto& acc : intSubscribers) {
+      acc.read();
+    }
+    doubleSubscriber.read();
+    countAllocations = false;
+  };
+
+  // warm up: all buffers in the queues must have been used once
+  for(int32_t i = 0; i < 10; ++i) {
+    interruptAndRead(i);
+  }
+
+  nAllocations = 0;
+  for(int32_t i = 0; i < 100; ++i) {
+    interruptAndRead(i);
+    for(auto& acc : intSubscribers) {
+      BOOST_CHECK_EQUAL(int32_t(acc), i);
+    }
+    BOOST_CHECK_CLOSE(double(doubleSubscriber), double(i), 1e-6);
+  }
+  BOOST_CHECK_EQUAL(nAllocations, 0);
+}
+
+/**********************************************************************************************************************/
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE AsyncNDRegisterAccessorTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "AsyncNDRegisterAccessor.h"
+#include "Device.h"
+#include "DummyBackend.h"
+using namespace ChimeraTK;
+
+#include <vector>
+
+/**********************************************************************************************************************/
+
+/*
+ * Helper to send a sequence of values to an accessor with wait_for_new_data on MODULE0/INTERRUPT_TYPE (interrupt 6)
+ * without reading in between, and to read back everything that has been queued.
+ */
+struct QueueTester {
+  explicit QueueTester(const std::string& parameters) : device("(dummy?map=goodMapFile.map" + parameters + ")") {
+    device.open();
+    dummy = boost::dynamic_pointer_cast<DummyBackend>(device.getBackend());
+    BOOST_REQUIRE(dummy);
+    writeable.replace(device.getScalarRegisterAccessor<int32_t>("MODULE0/INTERRUPT_TYPE/DUMMY_WRITEABLE"));
+    writeable = 0;
+    writeable.write();
+
+    accessor.replace(
+        device.getScalarRegisterAccessor<int32_t>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data}));
+    impl = boost::dynamic_pointer_cast<AsyncNDRegisterAccessor<int32_t>>(accessor.getHighLevelImplElement());
+    BOOST_REQUIRE(impl);
+
+    device.activateAsyncRead();
+    accessor.read(); // initial value
+  }
+
+  void send(const std::vector<int32_t>& values) {
+    for(auto value : values) {
+      writeable = value;
+      writeable.write();
+      dummy->triggerInterrupt(6);
+    }
+  }
+
+  std::vector<int32_t> receive() {
+    std::vector<int32_t> received;
+    while(accessor.readNonBlocking()) {
+      received.push_back(accessor);
+    }
+    return received;
+  }
+
+  Device device;
+  boost::shared_ptr<DummyBackend> dummy;
+  ScalarRegisterAccessor<int32_t> writeable;
+  ScalarRegisterAccessor<int32_t> accessor;
+  boost::shared_ptr<AsyncNDRegisterAccessor<int32_t>> impl;
+};
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDefault) {
+  QueueTester t("");
+  t.send({1, 2, 3, 4, 5});
+  // queue length 3, the last value is always overwritten with the newest one
+  BOOST_CHECK(t.receive() == std::vector<int32_t>({1, 2, 5}));
+  BOOST_CHECK_EQUAL(t.impl->getNumberOfOverflows(), 2);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testQueueLength) {
+  QueueTester t("&asyncQueueLength=8");
+  t.send({1, 2, 3, 4, 5, 6, 7, 8});
+  BOOST_CHECK(t.receive() == std::vector<int32_t>({1, 2, 3, 4, 5, 6, 7, 8}));
+  BOOST_CHECK_EQUAL(t.impl->getNumberOfOverflows(), 0);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDropNewest) {
+  QueueTester t("&asyncQueueLength=2&asyncOverflowPolicy=dropNewest");
+  t.send({1, 2, 3, 4});
+  BOOST_CHECK(t.receive() == std::vector<int32_t>({1, 2}));
+  BOOST_CHECK_EQUAL(t.impl->getNumberOfOverflows(), 2);
+
+  // values arriving after the queue has been emptied are received again
+  t.send({5});
+  BOOST_CHECK(t.receive() == std::vector<int32_t>({5}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidParameters) {
+  BOOST_CHECK_THROW(Device("(dummy?map=goodMapFile.map&asyncQueueLength=0)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=goodMapFile.map&asyncQueueLength=many)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=goodMapFile.map&asyncQueueLength=-1)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=goodMapFile.map&asyncQueueLength=65537)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=goodMapFile.map&asyncOverflowPolicy=dropOldest)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=goodMapFile.map&asyncOverflowPolicy=block)"), ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
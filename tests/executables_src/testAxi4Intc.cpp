@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Axi4IntcTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Axi4_Intc.h"
+#include "Device.h"
+#include "DummyBackend.h"
+#include "DummyRegisterAccessor.h"
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+struct Fixture {
+  Fixture() {
+    device.open("(dummy?map=testAxi4Intc.map)");
+    dummy = boost::dynamic_pointer_cast<DummyBackend>(device.getBackend());
+    BOOST_REQUIRE(dummy);
+
+    data3_0.replace(device.getScalarRegisterAccessor<int32_t>("/datafrom3_0", 0, {AccessMode::wait_for_new_data}));
+    data3_1.replace(device.getScalarRegisterAccessor<int32_t>("/datafrom3_1", 0, {AccessMode::wait_for_new_data}));
+    data3_4.replace(device.getScalarRegisterAccessor<int32_t>("/datafrom3_4", 0, {AccessMode::wait_for_new_data}));
+    data4_2.replace(device.getScalarRegisterAccessor<int32_t>("/datafrom4_2", 0, {AccessMode::wait_for_new_data}));
+
+    device.activateAsyncRead();
+    for(auto* acc : {&data3_0, &data3_1, &data3_4, &data4_2}) {
+      acc->read(); // initial value
+    }
+  }
+
+  // Set the pending interrupts and the data, and trigger the primary interrupt
+  void trigger(uint32_t primary, const std::string& pendingRegister, uint32_t pending) {
+    DummyRegisterAccessor<uint32_t> pendingInterrupts(dummy.get(), "", pendingRegister);
+    pendingInterrupts = pending;
+    for(auto& path : {"/datafrom3_0", "/datafrom3_1", "/datafrom3_4", "/datafrom4_2"}) {
+      DummyRegisterAccessor<int32_t> data(dummy.get(), "", path);
+      data = data + 1;
+    }
+    dummy->triggerInterrupt(primary);
+  }
+
+  uint32_t acknowledged(const std::string& controller) {
+    DummyRegisterAccessor<uint32_t> iar(dummy.get(), "", controller + "/IAR");
+    return iar;
+  }
+
+  Device device;
+  boost::shared_ptr<DummyBackend> dummy;
+  ScalarRegisterAccessor<int32_t> data3_0, data3_1, data3_4, data4_2;
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testOnlyPendingInterruptsAreDistributed, Fixture) {
+  trigger(3, "/intc3/IPR", (1U << 1U) | (1U << 4U));
+  BOOST_CHECK(!data3_0.readNonBlocking());
+  BOOST_CHECK(data3_1.readNonBlocking());
+  BOOST_CHECK(data3_4.readNonBlocking());
+  BOOST_CHECK(!data4_2.readNonBlocking());
+  BOOST_CHECK_EQUAL(acknowledged("/intc3"), (1U << 1U) | (1U << 4U));
+
+  trigger(3, "/intc3/IPR", 1U);
+  BOOST_CHECK(data3_0.readNonBlocking());
+  BOOST_CHECK(!data3_1.readNonBlocking());
+  BOOST_CHECK(!data3_4.readNonBlocking());
+  BOOST_CHECK_EQUAL(acknowledged("/intc3"), 1U);
+
+  // controller without the IPR option uses the ISR
+  trigger(4, "/intc4/ISR", 1U << 2U);
+  BOOST_CHECK(data4_2.readNonBlocking());
+  BOOST_CHECK(!data3_0.readNonBlocking());
+  BOOST_CHECK_EQUAL(acknowledged("/intc4"), 1U << 2U);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testInterruptsWithoutSubscriber, Fixture) {
+  // bit 7 has no subscriber: it is acknowledged together with the others but not an error
+  trigger(3, "/intc3/IPR", (1U << 7U) | (1U << 4U));
+  BOOST_CHECK(data3_4.readNonBlocking());
+  BOOST_CHECK(!data3_0.readNonBlocking());
+  BOOST_CHECK_EQUAL(acknowledged("/intc3"), (1U << 7U) | (1U << 4U));
+  BOOST_CHECK(device.isFunctional());
+
+  // nothing pending: nothing distributed and nothing acknowledged
+  DummyRegisterAccessor<uint32_t> iar(dummy.get(), "", "/intc3/IAR");
+  iar = 0;
+  trigger(3, "/intc3/IPR", 0);
+  for(auto* acc : {&data3_0, &data3_1, &data3_4}) {
+    BOOST_CHECK(!acc->readNonBlocking());
+  }
+  BOOST_CHECK_EQUAL(acknowledged("/intc3"), 0U);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidDescription) {
+  // missing path, unknown option and syntax error
+  InterruptControllerHandlerFactory factory(nullptr);
+  BOOST_CHECK_THROW(Axi4_Intc::create(&factory, {3}, R"({"options":["IPR"]})", {}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Axi4_Intc::create(&factory, {3}, R"({"path":"/intc3", "options":["IVR"]})", {}),
+      ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Axi4_Intc::create(&factory, {3}, "not json", {}), ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
@@ -4,6 +4,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE testDummyBackend
 
+#include "AsyncNDRegisterAccessor.h"
 #include "BackendFactory.h"
 #include "Device.h"
 #include "DummyBackend.h"
@@ -14,6 +15,10 @@
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 // FIXME Remove
 #include <regex>
 
@@ -59,6 +64,7 @@ class TestableDummyBackend : public DummyBackend {
   using DummyBackend::isWriteRangeOverlap;
   using DummyBackend::_readOnlyAddresses;
   using DummyBackend::_writeCallbackFunctions;
+  using DummyBackend::dispatchInterrupt;
 
   static boost::shared_ptr<DeviceBackend> createInstance(std::string, std::map<std::string, std::string> parameters) {
     return boost::shared_ptr<DeviceBackend>(new TestableDummyBackend(parameters["map"]));
@@ -529,6 +535,109 @@ BOOST_AUTO_TEST_CASE(testDummyInterrupt) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testSubscribeDuringDistribution) {
+  ChimeraTK::Device dummyDevice;
+  dummyDevice.open("DUMMYD0");
+  dummyDevice.activateAsyncRead();
+  auto backend = boost::dynamic_pointer_cast<DummyBackend>(dummyDevice.getBackend());
+  BOOST_REQUIRE(backend);
+
+  std::vector<VoidRegisterAccessor> subscribers;
+  for(size_t i = 0; i < 3; ++i) {
+    subscribers.push_back(dummyDevice.getVoidRegisterAccessor("/!3", {AccessMode::wait_for_new_data}));
+    subscribers.back().read(); // the initial value has arrived
+  }
+
+  // Subscribe and unsubscribe other accessors of the same interrupt concurrently to the distribution. Each of them
+  // must receive its initial value and then every value at most once. Boost test assertions are not thread safe, so
+  // the failures are counted.
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> nFailures{0};
+  std::thread subscriptionThread([&] {
+    while(!stop) {
+      auto accessor = dummyDevice.getVoidRegisterAccessor("/!3", {AccessMode::wait_for_new_data});
+      if(!accessor.readNonBlocking()) {
+        ++nFailures;
+      }
+      auto lastVersion = accessor.getVersionNumber();
+      while(accessor.readNonBlocking()) {
+        if(accessor.getVersionNumber() <= lastVersion) {
+          ++nFailures;
+        }
+        lastVersion = accessor.getVersionNumber();
+      }
+    }
+  });
+
+  // The subscribers which are present the whole time receive each interrupt exactly once.
+  for(size_t i = 0; i < 1000; ++i) {
+    auto version = backend->triggerInterrupt(3);
+    for(auto& accessor : subscribers) {
+      BOOST_CHECK(accessor.readNonBlocking());
+      BOOST_CHECK(accessor.getVersionNumber() == version);
+      BOOST_CHECK(!accessor.readNonBlocking());
+    }
+  }
+
+  stop = true;
+  subscriptionThread.join();
+  BOOST_CHECK_EQUAL(nFailures.load(), 0);
+
+  dummyDevice.close();
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testNumberOfCoalescedInterrupts) {
+  ChimeraTK::Device dummyDevice;
+  dummyDevice.open(EXISTING_DEVICE);
+  auto backend = boost::dynamic_pointer_cast<TestableDummyBackend>(dummyDevice.getBackend());
+  BOOST_REQUIRE(backend);
+  dummyDevice.activateAsyncRead();
+
+  auto asyncAccessor = dummyDevice.getVoidRegisterAccessor("/!3", {AccessMode::wait_for_new_data});
+  auto asyncImpl =
+      boost::dynamic_pointer_cast<AsyncNDRegisterAccessor<ChimeraTK::Void>>(asyncAccessor.getHighLevelImplElement());
+  BOOST_REQUIRE(asyncImpl);
+
+  // the initial value is not caused by an interrupt
+  asyncAccessor.read();
+  BOOST_CHECK_EQUAL(asyncImpl->getNumberOfCoalescedInterrupts(), 0);
+
+  // the dummy does not coalesce: each interrupt is one distribution
+  backend->triggerInterrupt(3);
+  asyncAccessor.read();
+  BOOST_CHECK_EQUAL(asyncImpl->getNumberOfCoalescedInterrupts(), 1);
+
+  // the number travels with each queued value (default queue length is 3)
+  std::vector<VersionNumber> versions;
+  versions.push_back(backend->dispatchInterrupt(3, 5));
+  versions.push_back(backend->triggerInterrupt(3));
+  versions.push_back(backend->dispatchInterrupt(3, 2));
+  BOOST_CHECK_EQUAL(asyncImpl->getNumberOfCoalescedInterrupts(), 1); // only updated by read
+  for(auto [version, nInterrupts] : {std::make_pair(versions[0], 5U), {versions[1], 1U}, {versions[2], 2U}}) {
+    asyncAccessor.read();
+    BOOST_CHECK(asyncAccessor.getVersionNumber() == version);
+    BOOST_CHECK_EQUAL(asyncImpl->getNumberOfCoalescedInterrupts(), nInterrupts);
+  }
+
+  // a value overwriting the last one in a full queue (default policy overwriteLast) replaces its number as well
+  for(size_t i = 0; i < 3; ++i) {
+    backend->dispatchInterrupt(3, 4);
+  }
+  auto overwritingVersion = backend->dispatchInterrupt(3, 7);
+  for(uint32_t nInterrupts : {4U, 4U, 7U}) {
+    asyncAccessor.read();
+    BOOST_CHECK_EQUAL(asyncImpl->getNumberOfCoalescedInterrupts(), nInterrupts);
+  }
+  BOOST_CHECK(asyncAccessor.getVersionNumber() == overwritingVersion);
+  BOOST_CHECK_EQUAL(asyncImpl->getNumberOfOverflows(), 1);
+
+  dummyDevice.close();
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testAddressRange) {
   TestableDummyBackend::AddressRange range24_8_0(0, 24, 8);
 
@@ -37,7 +37,9 @@ using namespace boost::unit_test_framework;
 
 #include "Exception.h"
 #include "FixedPointConverter.h"
+#include "SimdSupport.h"
 
+#include <cstring>
 #include <sstream>
 namespace ChimeraTK {
   using namespace ChimeraTK;
@@ -1627,4 +1629,118 @@ BOOST_AUTO_TEST_CASE(testVoid) {
   (void)output;
 }
 
+/**********************************************************************************************************************/
+
+// Compare vectorToCooked() (which uses the vectorised kernels if available) with scalarToCooked() for each element
+template<typename T, typename RAW>
+void checkVectorToCooked(FixedPointConverter const& converter, std::vector<RAW> const& raw) {
+  std::vector<T> cooked(raw.size());
+  converter.vectorToCooked<T>(raw.begin(), raw.end(), cooked.begin());
+  for(size_t i = 0; i < raw.size(); ++i) {
+    T expected = converter.scalarToCooked<T>(raw[i]);
+    BOOST_CHECK_MESSAGE(std::memcmp(&cooked[i], &expected, sizeof(T)) == 0,
+        "vectorToCooked<" << typeName<T>() << "> failed for nBits = " << converter.getNBits()
+                          << ", fractionalBits = " << converter.getFractionalBits() << ", signed = "
+                          << converter.isSigned() << ", raw = 0x" << std::hex << raw[i] << std::dec
+                          << ": expected " << expected << ", got " << cooked[i]);
+  }
+}
+
+// Compare vectorToRaw() (which uses the vectorised kernels if available) with toRaw() for each element. Values for
+// which toRaw() throws are skipped.
+template<typename T, typename RAW>
+void checkVectorToRaw(FixedPointConverter const& converter, std::vector<double> const& values) {
+  std::vector<T> cooked;
+  std::vector<RAW> expected;
+  for(auto value : values) {
+    if constexpr(std::is_integral<T>::value) {
+      if(!(value >= std::numeric_limits<T>::min() && value <= std::numeric_limits<T>::max())) continue;
+    }
+    try {
+      expected.push_back(static_cast<RAW>(converter.toRaw(static_cast<T>(value))));
+      cooked.push_back(static_cast<T>(value));
+    }
+    catch(boost::numeric::bad_numeric_cast&) {
+    }
+  }
+  std::vector<RAW> raw(cooked.size());
+  converter.vectorToRaw<T>(cooked.begin(), cooked.end(), raw.begin());
+  for(size_t i = 0; i < cooked.size(); ++i) {
+    BOOST_CHECK_MESSAGE(raw[i] == expected[i],
+        "vectorToRaw<" << typeName<T>() << "> failed for nBits = " << converter.getNBits()
+                       << ", fractionalBits = " << converter.getFractionalBits() << ", signed = "
+                       << converter.isSigned() << ", cooked = " << cooked[i] << ": expected 0x" << std::hex
+                       << expected[i] << ", got 0x" << raw[i] << std::dec);
+  }
+}
+
+// Check vectorToCooked() and vectorToRaw() for all configurations with the currently selected SIMD level
+void checkVectorConversionAllConfigurations() {
+  // The vectorised conversion must give bit-identical results to the scalar conversion for all configurations. The
+  // vector lengths are chosen to be no multiple of the SIMD width.
+  std::vector<int32_t> raw32{0, 1, -1, 2, -2, int32_t(0xAAAAAAAA), 0x55555555, std::numeric_limits<int32_t>::max(),
+      std::numeric_limits<int32_t>::min(), 0x0000FFFF, int32_t(0xFFFF0000), 0x00020000, 0x0001FFFF};
+  uint32_t seed = 42;
+  while(raw32.size() < 1027) {
+    seed = seed * 1664525 + 1013904223; // simple LCG to obtain reproducible pseudo-random bit patterns
+    raw32.push_back(int32_t(seed));
+  }
+  std::vector<int16_t> raw16;
+  for(auto value : raw32) raw16.push_back(int16_t(value));
+
+  struct Configuration {
+    unsigned int nBits;
+    int fractionalBits;
+    bool isSigned;
+  };
+  std::vector<Configuration> configurations{{32, 0, true}, {32, 0, false}, {32, -12, true}, {32, 31, false},
+      {32, 43, true}, {18, 0, true}, {18, -12, false}, {18, 7, true}, {18, 17, false}, {18, 43, true}, {16, 0, true},
+      {16, 0, false}, {16, -5, true}, {16, -5, false}, {16, 3, true}, {16, 3, false}, {12, 0, false}, {0, 5, false}};
+
+  for(auto& c : configurations) {
+    FixedPointConverter converter("vectorConversion", c.nBits, c.fractionalBits, c.isSigned);
+    checkVectorToCooked<int32_t>(converter, raw32);
+    checkVectorToCooked<float>(converter, raw32);
+    checkVectorToCooked<double>(converter, raw32);
+    checkVectorToCooked<int32_t>(converter, raw16);
+    checkVectorToCooked<float>(converter, raw16);
+    checkVectorToCooked<double>(converter, raw16);
+
+    // cooked values around and beyond the valid range, including values exactly between two raw values
+    std::vector<double> values{0., -0., 0.25, -0.25, 0.5, -0.5, 0.75, -0.75, 3.25, -3.25, 5.5, -5.5,
+        std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity()};
+    double resolution = std::pow(2., -c.fractionalBits);
+    for(auto raw : raw32) {
+      double cooked = converter.scalarToCooked<double>(raw);
+      values.push_back(cooked);
+      values.push_back(cooked + resolution / 2);
+      values.push_back(cooked * 1.5 + resolution / 4);
+    }
+    checkVectorToRaw<int32_t, int32_t>(converter, values);
+    checkVectorToRaw<float, int32_t>(converter, values);
+    checkVectorToRaw<double, int32_t>(converter, values);
+    checkVectorToRaw<int32_t, int16_t>(converter, values);
+    checkVectorToRaw<float, int16_t>(converter, values);
+    checkVectorToRaw<double, int16_t>(converter, values);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testVectorConversion) {
+  // run the comparison for the kernels of all SIMD levels supported by the CPU, including the scalar fallback
+  for(auto level : {detail::SimdLevel::none, detail::SimdLevel::sse41, detail::SimdLevel::avx2}) {
+    if(level > detail::getSupportedSimdLevel()) {
+      BOOST_TEST_MESSAGE("SIMD level " << int(level) << " is not supported by this CPU, skipping it.");
+      continue;
+    }
+    BOOST_TEST_CONTEXT("SIMD level " << int(level)) {
+      detail::setSimdLevelForTesting(level);
+      checkVectorConversionAllConfigurations();
+    }
+  }
+  detail::setSimdLevelForTesting(detail::getSupportedSimdLevel());
+  BOOST_CHECK_THROW(detail::setSimdLevelForTesting(detail::SimdLevel(int(detail::getSupportedSimdLevel()) + 1)),
+      ChimeraTK::logic_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
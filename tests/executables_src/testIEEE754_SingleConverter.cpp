@@ -8,8 +8,10 @@ using namespace boost::unit_test_framework;
 
 #include "Exception.h"
 #include "IEEE754_SingleConverter.h"
+#include "SimdSupport.h"
 using namespace ChimeraTK;
 
+#include <cstring>
 #include <float.h> // for float limits
 
 BOOST_AUTO_TEST_CASE(test_toCooked_3_25) {
@@ -121,3 +123,76 @@ BOOST_AUTO_TEST_CASE(test_toCooked_00) {
 
   BOOST_CHECK_EQUAL(converter.scalarToCooked<Boolean>(rawValue), false);
 }
+
+template<typename T>
+void checkVectorConversion(std::vector<float> const& values) {
+  IEEE754_SingleConverter converter;
+
+  // to cooked: compare with the element-wise conversion, skip values for which it throws
+  std::vector<int32_t> raw;
+  std::vector<T> expected;
+  for(auto value : values) {
+    int32_t rawValue;
+    memcpy(&rawValue, &value, sizeof(float));
+    try {
+      expected.push_back(converter.scalarToCooked<T>(rawValue));
+      raw.push_back(rawValue);
+    }
+    catch(boost::numeric::bad_numeric_cast&) {
+    }
+  }
+  std::vector<T> cooked(raw.size());
+  converter.vectorToCooked<T>(raw.begin(), raw.end(), cooked.begin());
+  BOOST_CHECK_EQUAL(memcmp(cooked.data(), expected.data(), cooked.size() * sizeof(T)), 0);
+
+  // to raw
+  std::vector<int32_t> expectedRaw;
+  for(auto value : expected) {
+    expectedRaw.push_back(int32_t(converter.toRaw(value)));
+  }
+  std::vector<int32_t> raw2(expected.size());
+  converter.vectorToRaw<T>(expected.begin(), expected.end(), raw2.begin());
+  BOOST_CHECK(raw2 == expectedRaw);
+}
+
+// Check vectorToCooked() and vectorToRaw() with the currently selected SIMD level
+void checkVectorConversionAllTypes() {
+  // The bulk conversion must give bit-identical results to the element-wise conversion. The vector length is chosen to
+  // be no multiple of the SIMD width.
+  std::vector<float> values{0.F, -0.F, 0.5F, -0.5F, 1.5F, -2.5F, 3.25F, -240.6F, 60000.7F, 2147483520.F, -2147483648.F,
+      FLT_MAX, -FLT_MAX, FLT_MIN, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()};
+  uint32_t seed = 42;
+  while(values.size() < 1027) {
+    seed = seed * 1664525 + 1013904223; // simple LCG to obtain reproducible pseudo-random values
+    values.push_back(float(int32_t(seed)) / float(1U << (seed % 31)));
+  }
+  checkVectorConversion<float>(values);
+  checkVectorConversion<double>(values);
+  checkVectorConversion<int32_t>(values);
+
+  // limiting of double values which do not fit into a float
+  IEEE754_SingleConverter converter;
+  std::vector<double> cooked(13, DBL_MAX);
+  cooked[3] = -DBL_MAX;
+  cooked[7] = 1.;
+  std::vector<int32_t> raw(cooked.size());
+  converter.vectorToRaw<double>(cooked.begin(), cooked.end(), raw.begin());
+  for(size_t i = 0; i < cooked.size(); ++i) {
+    BOOST_CHECK_EQUAL(raw[i], int32_t(converter.toRaw(cooked[i])));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_vectorConversion) {
+  // run the comparison for the kernels of all SIMD levels supported by the CPU, including the scalar fallback
+  for(auto level : {detail::SimdLevel::none, detail::SimdLevel::sse41, detail::SimdLevel::avx2}) {
+    if(level > detail::getSupportedSimdLevel()) {
+      BOOST_TEST_MESSAGE("SIMD level " << int(level) << " is not supported by this CPU, skipping it.");
+      continue;
+    }
+    BOOST_TEST_CONTEXT("SIMD level " << int(level)) {
+      detail::setSimdLevelForTesting(level);
+      checkVectorConversionAllTypes();
+    }
+  }
+  detail::setSimdLevelForTesting(detail::getSupportedSimdLevel());
+}
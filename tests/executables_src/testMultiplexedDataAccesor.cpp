@@ -465,4 +465,90 @@ BOOST_DATA_TEST_CASE(testAreaOfInterestLength, boost::unit_test::data::make({ARE
   }
 }
 
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testParallelConversion) {
+  // The parallel conversion must give identical results as the sequential one. Each dummy has its own memory, so
+  // the same raw data is written to both devices.
+  Device sequential("(dummy?map=sequences.map)");
+  Device parallel("(dummy?map=sequences.map&parallelConversion=1)");
+  sequential.open();
+  parallel.open();
+
+  for(std::string areaName : {"INT", "FRAC_INT", "CHAR", "FRAC_SHORT", "DMA", "MIXED"}) {
+    auto areaSequential = sequential.getOneDRegisterAccessor<int32_t>("TEST/" + areaName + ".MULTIPLEXED_RAW");
+    auto areaParallel = parallel.getOneDRegisterAccessor<int32_t>("TEST/" + areaName + ".MULTIPLEXED_RAW");
+    for(size_t i = 0; i < areaSequential.getNElements(); ++i) {
+      areaSequential[i] = int32_t(0x9E3779B9 * (i + 1));
+      areaParallel[i] = areaSequential[i];
+    }
+    areaSequential.write();
+    areaParallel.write();
+
+    auto muxedSequential = sequential.getTwoDRegisterAccessor<double>("TEST/" + areaName);
+    auto muxedParallel = parallel.getTwoDRegisterAccessor<double>("TEST/" + areaName);
+    muxedSequential.read();
+    muxedParallel.read();
+    BOOST_TEST_CONTEXT("area " << areaName) {
+      for(size_t c = 0; c < muxedSequential.getNChannels(); ++c) {
+        BOOST_TEST(muxedParallel[c] == muxedSequential[c], boost::test_tools::per_element());
+      }
+    }
+  }
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testParallelConversionOfSeveralBlocks) {
+  // The areas in sequences.map fit into a single block, which is always converted sequentially. This area has 16
+  // channels of 16 bit and 4096 samples, so it is split into several blocks. Each path is forced through the
+  // parallelConversion parameter and compared to the values decoded directly from the raw data.
+  Device sequential("(dummy?map=performanceTest.map&parallelConversion=0)");
+  Device parallel("(dummy?map=performanceTest.map&parallelConversion=1)");
+  sequential.open();
+  parallel.open();
+
+  auto rawSequential = sequential.getOneDRegisterAccessor<int32_t>("ADC/DAQ.MULTIPLEXED_RAW");
+  auto rawParallel = parallel.getOneDRegisterAccessor<int32_t>("ADC/DAQ.MULTIPLEXED_RAW");
+  for(size_t i = 0; i < rawSequential.getNElements(); ++i) {
+    rawSequential[i] = int32_t(0x9E3779B9 * (i + 1));
+    rawParallel[i] = rawSequential[i];
+  }
+  rawSequential.write();
+  rawParallel.write();
+
+  auto muxedSequential = sequential.getTwoDRegisterAccessor<int32_t>("ADC/DAQ");
+  auto muxedParallel = parallel.getTwoDRegisterAccessor<int32_t>("ADC/DAQ");
+  BOOST_REQUIRE_EQUAL(muxedSequential.getNChannels(), 16);
+  BOOST_REQUIRE_EQUAL(muxedSequential.getNElementsPerChannel(), 4096);
+
+  // read twice, so the second read reuses the buffers of the parallel conversion
+  for(size_t iteration = 0; iteration < 2; ++iteration) {
+    muxedSequential.read();
+    muxedParallel.read();
+    for(size_t c = 0; c < 16; ++c) {
+      std::vector<int32_t> expected;
+      for(size_t k = 0; k < 4096; ++k) {
+        // channel c of sample k is the 16 bit signed word number 16 * k + c of the raw data
+        auto word = uint32_t(rawSequential[(16 * k + c) / 2]);
+        expected.push_back(int16_t(c % 2 == 0 ? word & 0xFFFF : word >> 16));
+      }
+      BOOST_TEST_CONTEXT("iteration " << iteration << ", channel " << c) {
+        BOOST_TEST(muxedSequential[c] == expected, boost::test_tools::per_element());
+        BOOST_TEST(muxedParallel[c] == expected, boost::test_tools::per_element());
+      }
+    }
+  }
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidParallelConversion) {
+  BOOST_CHECK_THROW(Device("(dummy?map=sequences.map&parallelConversion=x)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=sequences.map&parallelConversion=-1)"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Device("(dummy?map=sequences.map&parallelConversion=1k)"), ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_SUITE_END()
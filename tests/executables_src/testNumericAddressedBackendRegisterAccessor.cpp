@@ -13,6 +13,7 @@ using namespace boost::unit_test_framework;
 #include "Device.h"
 #include "DummyBackend.h"
 #include "DummyRegisterAccessor.h"
+#include "RawBufferAllocator.h"
 #include "TransferGroup.h"
 
 namespace ChimeraTK {
@@ -275,6 +276,106 @@ BOOST_AUTO_TEST_CASE(testRawWithTransferGroup) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testRawZeroCopy) {
+  Device device;
+  device.open("(dummy?map=goodMapFile.map)");
+
+  // zero_copy requires raw
+  BOOST_CHECK_THROW(
+      std::ignore = device.getOneDRegisterAccessor<int>("MODULE1/TEST_AREA", 0, 0, {AccessMode::zero_copy}),
+      ChimeraTK::logic_error);
+
+  // zero_copy cannot be combined with wait_for_new_data, which is reported as such
+  try {
+    std::ignore = device.getScalarRegisterAccessor<int>(
+        "MODULE0/INTERRUPT_TYPE", 0, {AccessMode::raw, AccessMode::zero_copy, AccessMode::wait_for_new_data});
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ChimeraTK::logic_error& e) {
+    BOOST_CHECK(std::string(e.what()).find("wait_for_new_data") != std::string::npos);
+  }
+
+  auto zeroCopy =
+      device.getOneDRegisterAccessor<int>("MODULE1/TEST_AREA", 0, 0, {AccessMode::raw, AccessMode::zero_copy});
+  auto standalone = device.getOneDRegisterAccessor<int>("MODULE1/TEST_AREA", 0, 0, {AccessMode::raw});
+
+  // write and read through the user buffer
+  for(size_t i = 0; i < zeroCopy.getNElements(); ++i) {
+    zeroCopy[i] = 0x100 + int(i);
+  }
+  zeroCopy.write();
+  standalone.read();
+  for(size_t i = 0; i < standalone.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(standalone[i], 0x100 + int(i));
+  }
+
+  for(size_t i = 0; i < standalone.getNElements(); ++i) {
+    standalone[i] = 0x200 + int(i);
+  }
+  standalone.write();
+  zeroCopy.read();
+  for(size_t i = 0; i < zeroCopy.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(zeroCopy[i], 0x200 + int(i));
+  }
+
+  // swapping the user buffer between transfers is allowed
+  std::vector<int> other(zeroCopy.getNElements(), 0);
+  zeroCopy.swap(other);
+  zeroCopy.read();
+  for(size_t i = 0; i < zeroCopy.getNElements(); ++i) {
+    BOOST_CHECK_EQUAL(zeroCopy[i], 0x200 + int(i));
+  }
+  zeroCopy[0] = 0x300;
+  zeroCopy.write();
+  standalone.read();
+  BOOST_CHECK_EQUAL(standalone[0], 0x300);
+
+  // zero-copy accessors cannot be put into a TransferGroup, and the group stays unchanged
+  auto partial = device.getOneDRegisterAccessor<int>("MODULE1/TEST_AREA", 2, 2, {AccessMode::raw});
+  TransferGroup group;
+  group.addAccessor(partial);
+  BOOST_CHECK_THROW(group.addAccessor(zeroCopy), ChimeraTK::logic_error);
+
+  // the zero-copy accessor is not affected, while partial is still working in the group
+  standalone[0] = 0x400;
+  standalone[2] = 0x402;
+  standalone.write();
+  zeroCopy.read();
+  group.read();
+  BOOST_CHECK_EQUAL(zeroCopy[0], 0x400);
+  BOOST_CHECK_EQUAL(zeroCopy[2], 0x402);
+  BOOST_CHECK_EQUAL(partial[0], 0x402);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testRawBufferAllocator) {
+  // parsing of the CDD parameters
+  auto policy = detail::RawBufferPolicy::fromParameters({});
+  BOOST_CHECK_EQUAL(policy.alignment, 64);
+  BOOST_CHECK(!policy.hugePages);
+  policy = detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "4096"}, {"hugePages", "1"}});
+  BOOST_CHECK_EQUAL(policy.alignment, 4096);
+  BOOST_CHECK(policy.hugePages);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "48"}}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "abc"}}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "0"}}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "-64"}}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "64B"}}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"bufferAlignment", "4194304"}}), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(detail::RawBufferPolicy::fromParameters({{"hugePages", "yes"}}), ChimeraTK::logic_error);
+
+  // buffers are aligned and usable, with and without huge pages
+  for(size_t size : {size_t(1), size_t(1000), detail::RawBufferPolicy::hugePageSize + 1}) {
+    std::vector<uint8_t, detail::RawBufferAllocator<uint8_t>> buffer(
+        size, 0x42, detail::RawBufferAllocator<uint8_t>(policy));
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(buffer.data()) % policy.alignment, 0);
+    BOOST_CHECK_EQUAL(buffer.back(), 0x42);
+  }
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testConverterTypes) {
   // After the introduction of the IEEE754 floating point converter we have to test
   // that all possible converters (two at the moment) are created when they should,
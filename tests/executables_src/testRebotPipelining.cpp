@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE RebotPipeliningTest
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "NumericAddressedBackend.h"
+#include "RebotDummyServer.h"
+#include "TransferGroup.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Protocol version 0 server, which only answers read requests of up to 361 words
+struct F {
+  F()
+  : rebotServer{0 /*use random port*/, "./mtcadummy_rebot.map", 0 /*protocol version*/},
+    serverThread([&]() { rebotServer.start(); }) {
+    while(not rebotServer.is_running()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  ~F() {
+    rebotServer.stop();
+    serverThread.join();
+  }
+
+  std::string cdd(const std::string& parameters) {
+    return "(rebot?ip=localhost&port=" + std::to_string(rebotServer.port()) + "&map=mtcadummy_rebot.map" + parameters +
+        ")";
+  }
+
+  // Write and read back ADC.TEST_AREA, which has 1024 words. It is written with one request per word and read with
+  // three requests.
+  void checkReadLargeArea(const std::string& parameters) {
+    Device d(cdd(parameters));
+    d.open();
+
+    auto area = d.getOneDRegisterAccessor<int32_t>("ADC.TEST_AREA");
+    BOOST_REQUIRE_EQUAL(area.getNElements(), 1024);
+    for(size_t i = 0; i < area.getNElements(); ++i) {
+      area[i] = int32_t(3 * i + 1);
+    }
+    area.write();
+
+    auto readBack = d.getOneDRegisterAccessor<int32_t>("ADC.TEST_AREA");
+    readBack.read();
+    for(size_t i = 0; i < readBack.getNElements(); ++i) {
+      BOOST_CHECK_EQUAL(readBack[i], int32_t(3 * i + 1));
+    }
+
+    // the connection is still in sync
+    auto word = d.getScalarRegisterAccessor<int32_t>("BOARD.WORD_USER");
+    word = 42;
+    word.write();
+    word = 0;
+    word.read();
+    BOOST_CHECK_EQUAL(int32_t(word), 42);
+  }
+
+  RebotDummyServer rebotServer;
+  boost::thread serverThread;
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testPipelinedRead, F) {
+  // fewer requests in flight than blocks
+  checkReadLargeArea("&pipelineDepth=2");
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testPipelineDeeperThanRead, F) {
+  // all requests are sent at once
+  checkReadLargeArea("&pipelineDepth=8");
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testPipelinedWrite, F) {
+  // the single word writes are sent in ten full batches and one partial batch
+  checkReadLargeArea("&pipelineDepth=100");
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testWithoutPipelining, F) {
+  checkReadLargeArea("");
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testTransferGroupWithMergeGap, F) {
+  Device d(cdd("&pipelineDepth=4&mergeGap=64"));
+  d.open();
+
+  auto area = d.getOneDRegisterAccessor<int32_t>("ADC.TEST_AREA");
+  auto word = d.getScalarRegisterAccessor<int32_t>("BOARD.WORD_USER");
+  for(size_t i = 0; i < area.getNElements(); ++i) {
+    area[i] = int32_t(i);
+  }
+  area.write();
+  word = 120;
+  word.write();
+
+  // the registers are 36 bytes apart and are read with one merged transfer
+  TransferGroup group;
+  group.addAccessor(area);
+  group.addAccessor(word);
+  area[17] = 0;
+  word = 0;
+  auto session = rebotServer.session();
+  BOOST_REQUIRE(session);
+  auto nReadsBefore = session->_multiWordReadCount.load();
+  group.read();
+  BOOST_CHECK_EQUAL(area[17], 17);
+  BOOST_CHECK_EQUAL(area[1023], 1023);
+  BOOST_CHECK_EQUAL(int32_t(word), 120);
+
+  // The merged range from word 3 (BOARD.WORD_USER) to word 1035 (end of ADC.TEST_AREA) takes three requests. Separate
+  // transfers would take four.
+  BOOST_CHECK_EQUAL(session->_multiWordReadCount - nReadsBefore, 3U);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testFailedReadInPipeline, F) {
+  Device d(cdd("&pipelineDepth=4"));
+  d.open();
+  auto backend = boost::dynamic_pointer_cast<NumericAddressedBackend>(d.getBackend());
+  BOOST_REQUIRE(backend);
+  auto session = rebotServer.session();
+  BOOST_REQUIRE(session);
+
+  auto area = d.getOneDRegisterAccessor<int32_t>("ADC.TEST_AREA");
+  for(size_t i = 0; i < area.getNElements(); ++i) {
+    area[i] = int32_t(2 * i);
+  }
+  area.write();
+
+  // ADC.TEST_AREA starts at word 12 and is read with three requests, which are all sent at once. The server rejects
+  // the second one. The backend is used directly, so the device does not go into the exception state.
+  session->_rejectedWordAddress = 12 + 361;
+  auto nReadsBefore = session->_multiWordReadCount.load();
+  std::vector<int32_t> buffer(1024);
+  BOOST_CHECK_THROW(backend->read(uint64_t(0), uint64_t(0x30), buffer.data(), 4 * buffer.size()), runtime_error);
+  BOOST_CHECK_EQUAL(session->_multiWordReadCount - nReadsBefore, 3U);
+
+  // The answer to the third request has been collected, so the same connection is still in sync
+  session->_rejectedWordAddress = -1;
+  backend->read(uint64_t(0), uint64_t(0x30), buffer.data(), 4 * buffer.size());
+  for(size_t i = 0; i < buffer.size(); ++i) {
+    BOOST_CHECK_EQUAL(buffer[i], int32_t(2 * i));
+  }
+  BOOST_CHECK(rebotServer.session() == session);
+  BOOST_CHECK(d.isFunctional());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testFailedWordInBatchedWrite, F) {
+  Device d(cdd("&pipelineDepth=100"));
+  d.open();
+  auto backend = boost::dynamic_pointer_cast<NumericAddressedBackend>(d.getBackend());
+  BOOST_REQUIRE(backend);
+  auto session = rebotServer.session();
+  BOOST_REQUIRE(session);
+
+  std::vector<int32_t> buffer(1024, -1);
+  backend->write(uint64_t(0), uint64_t(0x30), buffer.data(), 4 * buffer.size());
+
+  // ADC.TEST_AREA starts at word 12. The server rejects word 162, which is in the middle of the second batch of 100
+  // requests. The backend is used directly, so the device does not go into the exception state.
+  session->_rejectedWordAddress = 162;
+  for(size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = int32_t(5 * i);
+  }
+  auto nWritesBefore = session->_singleWordWriteCount.load();
+  try {
+    backend->write(uint64_t(0), uint64_t(0x30), buffer.data(), 4 * buffer.size());
+    BOOST_ERROR("Writing a rejected word must throw");
+  }
+  catch(runtime_error& e) {
+    // only the rejected word is reported, with the response code of the server
+    BOOST_CHECK_EQUAL(std::string(e.what()), "Writing via ReboT failed for word addresses 162 (response code -1050)");
+  }
+  BOOST_CHECK_EQUAL(session->_singleWordWriteCount - nWritesBefore, 1024U);
+
+  // All answers have been collected, so the same connection is still in sync. All other words have been written.
+  session->_rejectedWordAddress = -1;
+  std::vector<int32_t> readBack(1024);
+  backend->read(uint64_t(0), uint64_t(0x30), readBack.data(), 4 * readBack.size());
+  for(size_t i = 0; i < readBack.size(); ++i) {
+    BOOST_CHECK_EQUAL(readBack[i], i == 150 ? -1 : int32_t(5 * i));
+  }
+  BOOST_CHECK(rebotServer.session() == session);
+  BOOST_CHECK(d.isFunctional());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidParameters) {
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&pipelineDepth=0)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&pipelineDepth=x)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&pipelineDepth=-1)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&pipelineDepth=4x)"), logic_error);
+  BOOST_CHECK_THROW(
+      Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&pipelineDepth=1000000)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&mergeGap=x)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&mergeGap=-4)"), logic_error);
+  BOOST_CHECK_THROW(
+      Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&mergeGap=100000000)"), logic_error);
+}
+
+/**********************************************************************************************************************/
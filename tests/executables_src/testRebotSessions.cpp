@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE RebotSessionsTest
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "RebotDummyServer.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Server which accepts up to three client connections
+struct F {
+  F()
+  : rebotServer{0 /*use random port*/, "./mtcadummy_rebot.map", 1 /*protocol version*/, 3 /*sessions*/},
+    serverThread([&]() { rebotServer.start(); }) {
+    while(not rebotServer.is_running()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  ~F() {
+    rebotServer.stop();
+    serverThread.join();
+  }
+
+  std::string cdd(const std::string& parameters) {
+    return "(rebot?ip=localhost&port=" + std::to_string(rebotServer.port()) + "&map=mtcadummy_rebot.map" + parameters +
+        ")";
+  }
+
+  RebotDummyServer rebotServer;
+  boost::thread serverThread;
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testConcurrentAccess, F) {
+  Device d(cdd("&sessions=3"));
+  d.open();
+  BOOST_CHECK_EQUAL(rebotServer.nSessions(), 3);
+
+  // Each thread writes and reads back its own register. Boost.Test assertions are not thread safe, so count the
+  // mismatches.
+  std::atomic<size_t> nMismatches{0};
+  std::vector<std::thread> threads;
+  for(size_t i = 0; i < 3; ++i) {
+    threads.emplace_back([&, i] {
+      auto accessor = d.getScalarRegisterAccessor<int32_t>("ADC.WORD_CLK_MUX_" + std::to_string(i));
+      for(int32_t value = 0; value < 100; ++value) {
+        accessor = int32_t(1000 * i) + value;
+        accessor.write();
+        accessor = -1;
+        accessor.read();
+        if(int32_t(accessor) != int32_t(1000 * i) + value) {
+          ++nMismatches;
+        }
+      }
+    });
+  }
+  for(auto& t : threads) {
+    t.join();
+  }
+  BOOST_CHECK_EQUAL(size_t(nMismatches), 0);
+  BOOST_CHECK(d.isFunctional());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testSessionRefused, F) {
+  // the server refuses the fourth connection
+  Device d(cdd("&sessions=4"));
+  BOOST_CHECK_THROW(d.open(), ChimeraTK::runtime_error);
+  BOOST_CHECK(!d.isFunctional());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidParameters) {
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&sessions=0)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&sessions=x)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&sessions=-2)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&sessions=2x)"), logic_error);
+  BOOST_CHECK_THROW(Device("(rebot?ip=localhost&port=5001&map=mtcadummy_rebot.map&sessions=1000)"), logic_error);
+}
+
+/**********************************************************************************************************************/
@@ -11,12 +11,15 @@
 #include "Utilities.h"
 
 #include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <string>
 #include <thread>
 #include <unistd.h>
@@ -165,6 +168,186 @@ namespace {
     BOOST_CHECK(backendInst3.get() != backendInst2.get());
   }
 
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testConsistentConcurrentReads) {
+    setDMapFilePath("shareddummyTest.dmap");
+    Device dev;
+    dev.open("SHDMEMDEV");
+
+    // Reads do not lock, but must never see a partially written area. The writer always writes the same value to all
+    // elements. Boost.Test assertions are not thread safe, so the reader threads count the torn reads.
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> nTornReads{0};
+    std::vector<std::thread> readers;
+    for(size_t i = 0; i < 2; ++i) {
+      readers.emplace_back([&, area = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3")]() mutable {
+        while(!stop) {
+          area.read();
+          if(std::adjacent_find(area.begin(), area.end(), std::not_equal_to<>()) != area.end()) {
+            ++nTornReads;
+          }
+        }
+      });
+    }
+
+    auto area = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3");
+    for(int value = 0; value < 10000; ++value) {
+      std::fill(area.begin(), area.end(), value);
+      area.write();
+    }
+    stop = true;
+    for(auto& t : readers) {
+      t.join();
+    }
+    BOOST_CHECK_EQUAL(size_t(nTornReads), 0);
+    dev.close();
+  }
+
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testConsistentReadsAcrossProcesses) {
+    setDMapFilePath("shareddummyTest.dmap");
+    Device dev;
+    dev.open("SHDMEMDEV");
+
+    auto area = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3");
+    std::fill(area.begin(), area.end(), 0);
+    area.write();
+
+    // Two other processes read the area without locking while this process writes to it. They check for torn reads.
+    std::atomic<size_t> nRunning{2};
+    std::atomic<size_t> nFailed{0};
+    std::vector<std::thread> readers;
+    for(size_t i = 0; i < 2; ++i) {
+      readers.emplace_back([&] {
+        if(std::system("./testSharedDummyBackendExt --run_test=SharedDummyBackendTestSuite/testConsistentReads")) {
+          ++nFailed;
+        }
+        --nRunning;
+      });
+    }
+
+    for(int value = 1; nRunning > 0; ++value) {
+      std::fill(area.begin(), area.end(), value);
+      area.write();
+    }
+    for(auto& t : readers) {
+      t.join();
+    }
+    BOOST_CHECK_EQUAL(size_t(nFailed), 0);
+    dev.close();
+  }
+
+  /********************************************************************************************************************/
+
+  // Backends created directly share their memory by instance ID and map file, not through the BackendFactory. A
+  // separate instance ID is used, so the tests do not interfere with the other test cases.
+  boost::shared_ptr<SharedDummyBackend> makeInterruptTestBackend() {
+    return boost::make_shared<SharedDummyBackend>(
+        "interruptTest", boost::filesystem::canonical("sharedDummyUnified.map").string());
+  }
+
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testInterruptWithMultipleWaiters) {
+    // Each backend has its own dispatcher thread waiting for interrupts. All of them must be woken up each time.
+    std::vector<boost::shared_ptr<SharedDummyBackend>> backends;
+    std::vector<boost::shared_ptr<NDRegisterAccessor<int32_t>>> accessors;
+    for(size_t i = 0; i < 3; ++i) {
+      backends.push_back(makeInterruptTestBackend());
+      backends.back()->open();
+      accessors.push_back(
+          backends.back()->getRegisterAccessor<int32_t>("INTD_ASYNC", 1, 0, {AccessMode::wait_for_new_data}));
+      backends.back()->activateAsyncRead();
+      accessors.back()->read(); // initial value
+    }
+
+    for(size_t i = 0; i < 100; ++i) {
+      backends[i % backends.size()]->triggerInterrupt(1);
+      for(auto& accessor : accessors) {
+        // A lost wake-up shows up as a timeout instead of a hanging test
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(!accessor->readNonBlocking()) {
+          BOOST_REQUIRE(std::chrono::steady_clock::now() < deadline);
+          std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+      }
+    }
+
+    // nothing more than one value per interrupt has been dispatched
+    for(auto& accessor : accessors) {
+      BOOST_CHECK(!accessor->readNonBlocking());
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testStopWhileIdle) {
+    // Destroying a backend stops its dispatcher thread, which may just be starting or already be waiting for
+    // interrupts. It must not miss the stop request and wait forever.
+    auto start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < 200; ++i) {
+      auto backend = makeInterruptTestBackend();
+      if(i % 2) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    BOOST_CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(20));
+  }
+
+  /********************************************************************************************************************/
+
+  BOOST_AUTO_TEST_CASE(testConcurrentFirstInterrupts) {
+    // Two other processes trigger the same interrupt at the same time, which has not been triggered before in this
+    // shared memory. They race for adding the entry of the interrupt, which must be added only once, and this process
+    // must receive all interrupts (including the ones which happened before its dispatcher saw the new entry).
+    // The queue is long enough to hold all interrupts.
+    setDMapFilePath("shareddummyTest.dmap");
+    Device dev;
+    dev.open("(sharedMemoryDummy:concurrentInterruptTest?map=sharedDummyUnified.map&asyncQueueLength=3000)");
+    auto accessor = dev.getScalarRegisterAccessor<int32_t>("INTD_ASYNC", 0, {AccessMode::wait_for_new_data});
+    dev.activateAsyncRead();
+    accessor.read(); // initial value
+
+    // Both processes start triggering at the same time, one second from now, which leaves them time to start up
+    auto triggerTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        (std::chrono::system_clock::now() + std::chrono::seconds(1)).time_since_epoch());
+    std::string command = "SHARED_DUMMY_TRIGGER_TIME=" + std::to_string(triggerTime.count()) +
+        " ./testSharedDummyBackendExt --run_test=SharedDummyBackendTestSuite/testTriggerInterrupts";
+    std::atomic<size_t> nFailed{0};
+    std::vector<std::thread> triggers;
+    for(size_t i = 0; i < 2; ++i) {
+      triggers.emplace_back([&] {
+        if(std::system(command.c_str())) {
+          ++nFailed;
+        }
+      });
+    }
+    for(auto& t : triggers) {
+      t.join();
+    }
+    BOOST_REQUIRE_EQUAL(size_t(nFailed), 0);
+
+    // each process triggers 1000 interrupts
+    size_t nReceived = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while(nReceived < 2000 && std::chrono::steady_clock::now() < deadline) {
+      if(accessor.readNonBlocking()) {
+        ++nReceived;
+      }
+      else {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    while(accessor.readNonBlocking()) {
+      ++nReceived;
+    }
+    BOOST_CHECK_EQUAL(nReceived, 2000);
+    dev.close();
+  }
+
 } // anonymous namespace
 
 /**********************************************************************************************************************/
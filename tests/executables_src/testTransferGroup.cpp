@@ -14,6 +14,8 @@ using namespace boost::unit_test_framework;
 #include "TransferElementTestAccessor.h"
 #include "TransferGroup.h"
 
+#include <set>
+
 using namespace boost::unit_test_framework;
 using namespace ChimeraTK;
 
@@ -21,6 +23,50 @@ boost::shared_ptr<TransferElementTestAccessor<int32_t>> makeTETA(AccessModeFlags
   return boost::make_shared<TransferElementTestAccessor<int32_t>>(flags);
 }
 
+/**********************************************************************************************************************/
+
+/** DummyBackend which allows merging of transfers with gaps and counts the read and write requests */
+struct MergeGapBackend : public DummyBackend {
+  using DummyBackend::DummyBackend;
+
+  static boost::shared_ptr<DeviceBackend> createInstance(std::string, std::map<std::string, std::string> parameters) {
+    return returnInstance<MergeGapBackend>(parameters.at("map"), convertPathRelativeToDmapToAbs(parameters.at("map")));
+  }
+
+  size_t maximumMergeGap([[maybe_unused]] uint64_t bar) const override { return mergeGap; }
+
+  void read(uint64_t bar, uint64_t address, int32_t* data, size_t sizeInBytes) override {
+    if(interruptReads) {
+      throw boost::thread_interrupted();
+    }
+    ++readCount;
+    DummyBackend::read(bar, address, data, sizeInBytes);
+  }
+
+  void write(uint64_t bar, uint64_t address, int32_t const* data, size_t sizeInBytes) override {
+    ++writeCount;
+    for(size_t offset = 0; offset < sizeInBytes; offset += sizeof(int32_t)) {
+      writtenAddresses.insert(address + offset);
+    }
+    DummyBackend::write(bar, address, data, sizeInBytes);
+  }
+
+  size_t mergeGap{0};
+  size_t readCount{0};
+  size_t writeCount{0};
+  std::set<uint64_t> writtenAddresses;
+  bool interruptReads{false};
+
+  struct BackendRegisterer {
+    BackendRegisterer() {
+      ChimeraTK::BackendFactory::getInstance().registerBackendType(
+          "MergeGapDummy", &MergeGapBackend::createInstance, {"map"});
+    }
+  };
+};
+
+static MergeGapBackend::BackendRegisterer gMergeGapBackendRegisterer;
+
 /**********************************************************************************************************************/
 /**********************************************************************************************************************/
 /** Tests for single specification points */
@@ -629,6 +675,227 @@ BOOST_AUTO_TEST_CASE(testExceptionHandling) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testParallelTransfers) {
+  const std::string EXCEPTION_DUMMY_CDD = "(ExceptionDummy:2?map=test3.map)";
+  BackendFactory::getInstance().setDMapFilePath("dummies.dmap");
+  ChimeraTK::Device device1;
+  ChimeraTK::Device device2;
+  ChimeraTK::Device device3;
+
+  device1.open("DUMMYD1");
+  auto exceptionDummy = boost::dynamic_pointer_cast<ChimeraTK::ExceptionDummy>(
+      ChimeraTK::BackendFactory::getInstance().createBackend(EXCEPTION_DUMMY_CDD));
+  device2.open(EXCEPTION_DUMMY_CDD);
+  device3.open("DUMMYD2");
+
+  auto accessor1 = device1.getScalarRegisterAccessor<int>("/BOARD/WORD_FIRMWARE");
+  auto accessor1w = device1.getScalarRegisterAccessor<int>("/BOARD/WORD_FIRMWARE");
+  auto accessor2 = device2.getScalarRegisterAccessor<int>("/Integers/signed32");
+  auto accessor2w = device2.getScalarRegisterAccessor<int>("/Integers/signed32");
+  auto accessor3 = device3.getScalarRegisterAccessor<int>("/BOARD/WORD_FIRMWARE");
+  auto accessor3w = device3.getScalarRegisterAccessor<int>("/BOARD/WORD_FIRMWARE");
+
+  TransferGroup tg;
+  BOOST_CHECK(!tg.hasParallelTransfers());
+  tg.setParallelTransfers(true);
+  BOOST_CHECK(tg.hasParallelTransfers());
+  tg.addAccessor(accessor1);
+  tg.addAccessor(accessor2);
+  tg.addAccessor(accessor3);
+
+  // read
+  accessor1w = 11;
+  accessor2w = 22;
+  accessor3w = 33;
+  accessor1w.write();
+  accessor2w.write();
+  accessor3w.write();
+  tg.read();
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor1), 11);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor2), 22);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor3), 33);
+
+  // write
+  accessor1 = 44;
+  accessor2 = 55;
+  accessor3 = 66;
+  tg.write();
+  accessor1w.read();
+  accessor2w.read();
+  accessor3w.read();
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor1w), 44);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor2w), 55);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor3w), 66);
+
+  // exception in one backend is reported like in sequential mode and no user buffer is updated
+  accessor1 = 1;
+  accessor2 = 2;
+  accessor3 = 3;
+  exceptionDummy->throwExceptionRead = true;
+  BOOST_CHECK_THROW(tg.read(), ChimeraTK::runtime_error);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor1), 1);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor2), 2);
+  BOOST_CHECK_EQUAL(static_cast<int>(accessor3), 3);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testMergeWithGaps) {
+  BackendFactory::getInstance().setDMapFilePath("dummies.dmap");
+
+  // BOARD.WORD_FIRMWARE and BOARD.WORD_STATUS are separated by a gap of 4 bytes (BOARD.WORD_COMPILATION)
+  for(size_t mergeGap : {0, 4}) {
+    ChimeraTK::Device device("(MergeGapDummy?map=mtcadummy.map)");
+    device.open();
+    auto backend = boost::dynamic_pointer_cast<MergeGapBackend>(device.getBackend());
+    BOOST_REQUIRE(backend);
+    backend->mergeGap = mergeGap;
+
+    auto firmware = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE");
+    auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+    auto compilation = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_COMPILATION");
+
+    TransferGroup group;
+    group.addAccessor(firmware);
+    group.addAccessor(status);
+
+    firmware = 1;
+    status = 2;
+    compilation = 3;
+    compilation.write();
+    backend->readCount = 0;
+    backend->writeCount = 0;
+    backend->writtenAddresses.clear();
+    group.write();
+    // writes are never merged across gaps, and the gap is neither read nor written
+    BOOST_CHECK_EQUAL(backend->writeCount, 2);
+    BOOST_CHECK_EQUAL(backend->readCount, 0);
+    BOOST_CHECK(backend->writtenAddresses == std::set<uint64_t>({0, 8}));
+
+    compilation.read();
+    BOOST_CHECK_EQUAL(int32_t(compilation), 3);
+
+    firmware = 0;
+    status = 0;
+    backend->readCount = 0;
+    group.read();
+    BOOST_CHECK_EQUAL(backend->readCount, mergeGap == 0 ? 2 : 1);
+    BOOST_CHECK_EQUAL(int32_t(firmware), 1);
+    BOOST_CHECK_EQUAL(int32_t(status), 2);
+  }
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testThreadInterruptedInReadMultiple) {
+  BackendFactory::getInstance().setDMapFilePath("dummies.dmap");
+  ChimeraTK::Device device("(MergeGapDummy?map=mtcadummy.map)");
+  device.open();
+  auto backend = boost::dynamic_pointer_cast<MergeGapBackend>(device.getBackend());
+  BOOST_REQUIRE(backend);
+  backend->mergeGap = 0;
+  ChimeraTK::Device otherDevice("DUMMYD2");
+  otherDevice.open();
+
+  auto firmware = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE");
+  auto status = device.getScalarRegisterAccessor<int32_t>("BOARD.WORD_STATUS");
+  auto other = otherDevice.getScalarRegisterAccessor<int32_t>("BOARD.WORD_FIRMWARE");
+  firmware = 1;
+  firmware.write();
+  status = 2;
+  status.write();
+  other = 3;
+  other.write();
+
+  // The two registers of the MergeGapDummy are read with readMultiple(). An interruption of it reaches the application
+  // like a runtime error, also if the backends are transferred by separate tasks.
+  for(bool parallel : {false, true}) {
+    TransferGroup group;
+    group.setParallelTransfers(parallel);
+    group.addAccessor(firmware);
+    group.addAccessor(status);
+    group.addAccessor(other);
+
+    firmware = 0;
+    status = 0;
+    other = 0;
+    backend->interruptReads = true;
+    BOOST_CHECK_THROW(group.read(), boost::thread_interrupted);
+    BOOST_CHECK_EQUAL(int32_t(firmware), 0);
+    BOOST_CHECK_EQUAL(int32_t(status), 0);
+    BOOST_CHECK_EQUAL(int32_t(other), 0);
+
+    backend->interruptReads = false;
+    group.read();
+    BOOST_CHECK_EQUAL(int32_t(firmware), 1);
+    BOOST_CHECK_EQUAL(int32_t(status), 2);
+    BOOST_CHECK_EQUAL(int32_t(other), 3);
+  }
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testAddAccessors) {
+  BackendFactory::getInstance().setDMapFilePath("dummies.dmap");
+  ChimeraTK::Device device("(MergeGapDummy?map=mtcadummy.map)");
+  device.open();
+  auto backend = boost::dynamic_pointer_cast<MergeGapBackend>(device.getBackend());
+  BOOST_REQUIRE(backend);
+  backend->mergeGap = 0;
+
+  // one scalar accessor per word of the area, in reverse order to make sure the merging does not depend on the order
+  const size_t nWords = 1024;
+  std::vector<ScalarRegisterAccessor<int32_t>> accessors;
+  for(size_t i = 0; i < nWords; ++i) {
+    accessors.push_back(device.getScalarRegisterAccessor<int32_t>("ADC/AREA_DMAABLE", nWords - 1 - i));
+  }
+  // two accessors to the same word, which should be replaced by each other
+  accessors.push_back(device.getScalarRegisterAccessor<int32_t>("BOARD/WORD_STATUS"));
+  accessors.push_back(device.getScalarRegisterAccessor<int32_t>("BOARD/WORD_STATUS"));
+
+  auto area = device.getOneDRegisterAccessor<int32_t>("ADC/AREA_DMAABLE");
+  for(size_t i = 0; i < nWords; ++i) area[i] = int32_t(i * 3);
+  area.write();
+
+  TransferGroup group;
+  group.addAccessors(accessors);
+
+  // everything is merged into one transfer per bar
+  backend->readCount = 0;
+  group.read();
+  BOOST_CHECK_EQUAL(backend->readCount, 2);
+  for(size_t i = 0; i < nWords; ++i) {
+    BOOST_CHECK_EQUAL(int32_t(accessors[i]), int32_t((nWords - 1 - i) * 3));
+  }
+
+  // the identical accessors have been replaced, which makes the group read-only (cf. testAdding)
+  BOOST_CHECK(accessors[nWords].getHighLevelImplElement() == accessors[nWords + 1].getHighLevelImplElement());
+  BOOST_CHECK(group.isReadOnly());
+
+  // accessors can be added only once
+  TransferGroup group2;
+  BOOST_CHECK_THROW(group2.addAccessors(accessors), ChimeraTK::logic_error);
+
+  std::vector<ScalarRegisterAccessor<int32_t>> duplicates;
+  duplicates.push_back(device.getScalarRegisterAccessor<int32_t>("BOARD/WORD_FIRMWARE"));
+  duplicates.push_back(duplicates.front());
+  BOOST_CHECK_THROW(group2.addAccessors(duplicates), ChimeraTK::logic_error);
+  // the group has not been altered and the accessors can still be added individually
+  group2.addAccessor(duplicates.front());
+
+  // ranges of TransferElements can be added as well
+  std::vector<boost::shared_ptr<TransferElement>> elements;
+  elements.push_back(device.getScalarRegisterAccessor<int32_t>("BOARD/WORD_COMPILATION").getHighLevelImplElement());
+  elements.push_back(device.getScalarRegisterAccessor<int32_t>("BOARD/WORD_STATUS").getHighLevelImplElement());
+  TransferGroup group3;
+  group3.addAccessors(elements);
+  backend->readCount = 0;
+  group3.read();
+  BOOST_CHECK_EQUAL(backend->readCount, 1);
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testAdding) {
   BackendFactory::getInstance().setDMapFilePath("dummies.dmap");
   ChimeraTK::Device device;
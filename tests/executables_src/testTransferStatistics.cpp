@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE TransferStatisticsTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "TransferGroup.h"
+#include "TransferStatistics.h"
+using namespace ChimeraTK;
+
+#include <chrono>
+#include <numeric>
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testDisabledByDefault) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.open();
+  BOOST_CHECK(!device.getTransferStatistics());
+
+  auto acc = device.getScalarRegisterAccessor<int32_t>("MODULE0/WORD_USER1");
+  acc.read();
+  BOOST_CHECK(!acc.getTransferStatistics());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testCountsAndBytes) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.open();
+
+  // accessor obtained before enabling is not instrumented
+  auto before = device.getScalarRegisterAccessor<int32_t>("MODULE0/WORD_USER1");
+
+  device.enableTransferStatistics();
+  auto backendStatistics = device.getTransferStatistics();
+  BOOST_REQUIRE(backendStatistics);
+
+  auto scalar = device.getScalarRegisterAccessor<int32_t>("MODULE0/WORD_USER1");
+  auto array = device.getOneDRegisterAccessor<double>("MODULE1/TEST_AREA");
+  BOOST_REQUIRE(scalar.getTransferStatistics());
+  BOOST_REQUIRE(array.getTransferStatistics());
+  BOOST_CHECK(!before.getTransferStatistics());
+  BOOST_CHECK_EQUAL(array.getTransferStatistics()->getBytesPerTransfer(), 10 * sizeof(double));
+
+  before.read();
+  scalar.read();
+  scalar.read();
+  scalar.write();
+  array.read();
+  array.write();
+  array.write();
+  array.write();
+
+  auto s = scalar.getTransferStatistics()->get();
+  BOOST_CHECK_EQUAL(s.nReads, 2);
+  BOOST_CHECK_EQUAL(s.nWrites, 1);
+  BOOST_CHECK_EQUAL(s.nBytesRead, 2 * sizeof(int32_t));
+  BOOST_CHECK_EQUAL(s.nBytesWritten, sizeof(int32_t));
+  BOOST_CHECK_EQUAL(std::accumulate(s.readLatencyHistogram.begin(), s.readLatencyHistogram.end(), uint64_t(0)), 2);
+  BOOST_CHECK_EQUAL(std::accumulate(s.writeLatencyHistogram.begin(), s.writeLatencyHistogram.end(), uint64_t(0)), 1);
+
+  auto a = array.getTransferStatistics()->get();
+  BOOST_CHECK_EQUAL(a.nReads, 1);
+  BOOST_CHECK_EQUAL(a.nWrites, 3);
+  BOOST_CHECK_EQUAL(a.nBytesWritten, 3 * 10 * sizeof(double));
+
+  // the backend aggregates both accessors (but not the one obtained before enabling)
+  auto b = backendStatistics->get();
+  BOOST_CHECK_EQUAL(b.nReads, 3);
+  BOOST_CHECK_EQUAL(b.nWrites, 4);
+  BOOST_CHECK_EQUAL(b.nBytesRead, 2 * sizeof(int32_t) + 10 * sizeof(double));
+  BOOST_CHECK_EQUAL(b.nBytesWritten, sizeof(int32_t) + 3 * 10 * sizeof(double));
+  BOOST_CHECK(b.totalReadLatency >= s.totalReadLatency + a.totalReadLatency);
+
+  // reset only affects the accessor itself
+  backendStatistics->reset();
+  BOOST_CHECK_EQUAL(backendStatistics->get().nReads, 0);
+  BOOST_CHECK_EQUAL(scalar.getTransferStatistics()->get().nReads, 2);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInternalAccessorsNotRecorded) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.open();
+  device.enableTransferStatistics();
+
+  // accessors obtained directly from the backend are used internally (e.g. by other backends) and must not count
+  // the transfers of the user a second time
+  auto internal = device.getBackend()->getRegisterAccessor<int32_t>("MODULE0/WORD_USER1", 1, 0, {});
+  BOOST_CHECK(!internal->getTransferStatistics());
+  internal->read();
+  BOOST_CHECK_EQUAL(device.getTransferStatistics()->get().nReads, 0);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTransferGroup) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.open();
+  device.enableTransferStatistics();
+
+  auto scalar = device.getScalarRegisterAccessor<int32_t>("MODULE0/WORD_USER1");
+  auto array = device.getOneDRegisterAccessor<double>("MODULE1/TEST_AREA");
+  TransferGroup group;
+  group.addAccessor(scalar);
+  group.addAccessor(array);
+
+  // the group records the transfers of the high-level elements, not of the low-level elements it actually uses
+  group.read();
+  group.read();
+  group.write();
+  auto s = scalar.getTransferStatistics()->get();
+  BOOST_CHECK_EQUAL(s.nReads, 2);
+  BOOST_CHECK_EQUAL(s.nWrites, 1);
+  auto a = array.getTransferStatistics()->get();
+  BOOST_CHECK_EQUAL(a.nReads, 2);
+  BOOST_CHECK_EQUAL(a.nWrites, 1);
+  BOOST_CHECK_EQUAL(a.nBytesRead, 2 * 10 * sizeof(double));
+  auto b = device.getTransferStatistics()->get();
+  BOOST_CHECK_EQUAL(b.nReads, 4);
+  BOOST_CHECK_EQUAL(b.nWrites, 2);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testTransferGroupLatencyPerRegister) {
+  // two backends, so the transfers of both registers are independent
+  Device small("(dummy?map=goodMapFile.map)");
+  Device large("(dummy?map=performanceTest.map)");
+  small.open();
+  large.open();
+  small.enableTransferStatistics();
+  large.enableTransferStatistics();
+
+  auto scalar = small.getScalarRegisterAccessor<int32_t>("MODULE0/WORD_USER1");
+  auto area = large.getOneDRegisterAccessor<int32_t>("ADC/AREA_DMAABLE", 0, 0, {AccessMode::raw});
+  TransferGroup group;
+  group.addAccessor(scalar);
+  group.addAccessor(area);
+
+  // each register records only the duration of its own transfers, not the duration of the entire group
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i = 0; i < 10; ++i) {
+    group.read();
+  }
+  auto duration = std::chrono::steady_clock::now() - start;
+
+  auto s = scalar.getTransferStatistics()->get();
+  auto a = area.getTransferStatistics()->get();
+  BOOST_CHECK_EQUAL(s.nReads, 10);
+  BOOST_CHECK_EQUAL(a.nReads, 10);
+  BOOST_CHECK(s.totalReadLatency < a.totalReadLatency);
+  BOOST_CHECK(s.totalReadLatency + a.totalReadLatency <= duration);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testFailedTransfersNotRecorded) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.enableTransferStatistics();
+  auto acc = device.getScalarRegisterAccessor<int32_t>("MODULE0/WORD_USER1");
+
+  // device is not opened
+  BOOST_CHECK_THROW(acc.read(), ChimeraTK::logic_error);
+  BOOST_CHECK_EQUAL(acc.getTransferStatistics()->get().nReads, 0);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testHistogram) {
+  TransferStatistics statistics(4);
+  statistics.recordRead(std::chrono::nanoseconds(0));
+  statistics.recordRead(std::chrono::nanoseconds(1));
+  statistics.recordRead(std::chrono::nanoseconds(1000)); // 2^9 <= 1000 < 2^10
+  statistics.recordRead(std::chrono::nanoseconds(1024)); // 2^10
+  statistics.recordRead(std::chrono::seconds(100));      // overflow bucket
+  statistics.recordWrite(std::chrono::microseconds(3));  // 2^11 <= 3000 < 2^12
+
+  auto s = statistics.get();
+  BOOST_CHECK_EQUAL(s.nReads, 5);
+  BOOST_CHECK_EQUAL(s.nBytesRead, 20);
+  BOOST_CHECK_EQUAL(s.readLatencyHistogram[0], 2);
+  BOOST_CHECK_EQUAL(s.readLatencyHistogram[9], 1);
+  BOOST_CHECK_EQUAL(s.readLatencyHistogram[10], 1);
+  BOOST_CHECK_EQUAL(s.readLatencyHistogram[TransferStatistics::nLatencyBuckets - 1], 1);
+  BOOST_CHECK_EQUAL(s.writeLatencyHistogram[11], 1);
+  BOOST_CHECK(s.totalWriteLatency == std::chrono::microseconds(3));
+
+  using Snapshot = TransferStatistics::Snapshot;
+  BOOST_CHECK(Snapshot::latencyQuantile(s.readLatencyHistogram, 0.4) == Snapshot::bucketLowerBound(1));
+  BOOST_CHECK(Snapshot::latencyQuantile(s.readLatencyHistogram, 0.5) == Snapshot::bucketLowerBound(10));
+  BOOST_CHECK(Snapshot::latencyQuantile(s.readLatencyHistogram, 0.8) == Snapshot::bucketLowerBound(11));
+  BOOST_CHECK(Snapshot::latencyQuantile(s.writeLatencyHistogram, 1.) == std::chrono::nanoseconds(4096));
+  BOOST_CHECK(Snapshot::latencyQuantile({}, 0.5) == std::chrono::nanoseconds(0));
+}
+
+/**********************************************************************************************************************/
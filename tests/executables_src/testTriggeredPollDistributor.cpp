@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE TriggeredPollDistributorTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "DummyBackend.h"
+using namespace ChimeraTK;
+
+#include <iterator>
+#include <list>
+
+/**********************************************************************************************************************/
+
+/*
+ * Several subscribers to the same register with identical type, offset and length share the polled data. All of them
+ * must still get complete and identical values, also when subscribers join or leave while async read is active.
+ */
+BOOST_AUTO_TEST_CASE(testSharedPollSource) {
+  Device device("(dummy?map=goodMapFile.map)");
+  device.open();
+  auto dummy = boost::dynamic_pointer_cast<DummyBackend>(device.getBackend());
+  BOOST_REQUIRE(dummy);
+
+  auto writeable = device.getScalarRegisterAccessor<double>("MODULE0/INTERRUPT_TYPE/DUMMY_WRITEABLE");
+  writeable = 1.5;
+  writeable.write();
+
+  std::list<ScalarRegisterAccessor<double>> subscribers;
+  for(size_t i = 0; i < 3; ++i) {
+    subscribers.push_back(
+        device.getScalarRegisterAccessor<double>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data}));
+  }
+  // different user type: has its own source
+  auto intSubscriber =
+      device.getScalarRegisterAccessor<int32_t>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data});
+
+  device.activateAsyncRead();
+  for(auto& acc : subscribers) {
+    acc.read();
+    BOOST_CHECK_CLOSE(double(acc), 1.5, 1e-6);
+  }
+  intSubscriber.read();
+  BOOST_CHECK_EQUAL(int32_t(intSubscriber), 2);
+
+  // several interrupts in a row: all subscribers get each value
+  for(double value : {2.25, -3.5, 4.0}) {
+    writeable = value;
+    writeable.write();
+    dummy->triggerInterrupt(6);
+    for(auto& acc : subscribers) {
+      acc.read();
+      BOOST_CHECK_CLOSE(double(acc), value, 1e-6);
+      BOOST_CHECK(acc.getVersionNumber() == subscribers.front().getVersionNumber());
+    }
+    intSubscriber.read();
+    BOOST_CHECK(intSubscriber.getVersionNumber() == subscribers.front().getVersionNumber());
+  }
+
+  // a subscriber joining while active gets the current value as initial value, without a new interrupt
+  writeable = 5.5;
+  writeable.write();
+  subscribers.push_back(
+      device.getScalarRegisterAccessor<double>("MODULE0/INTERRUPT_TYPE", 0, {AccessMode::wait_for_new_data}));
+  subscribers.back().read();
+  BOOST_CHECK_CLOSE(double(subscribers.back()), 5.5, 1e-6);
+  for(auto it = subscribers.begin(); it != std::prev(subscribers.end()); ++it) {
+    BOOST_CHECK(!it->readNonBlocking());
+  }
+
+  dummy->triggerInterrupt(6);
+  for(auto& acc : subscribers) {
+    acc.read();
+    BOOST_CHECK_CLOSE(double(acc), 5.5, 1e-6);
+  }
+
+  // subscribers leaving
+  subscribers.pop_front();
+  subscribers.pop_front();
+  writeable = 6.75;
+  writeable.write();
+  dummy->triggerInterrupt(6);
+  for(auto& acc : subscribers) {
+    acc.read();
+    BOOST_CHECK_CLOSE(double(acc), 6.75, 1e-6);
+  }
+  dummy->triggerInterrupt(6);
+  for(auto& acc : subscribers) {
+    acc.read();
+    BOOST_CHECK_CLOSE(double(acc), 6.75, 1e-6);
+  }
+}
+
+/**********************************************************************************************************************/
@@ -7,6 +7,7 @@
 #include <boost/test/unit_test.hpp>
 using namespace boost::unit_test_framework;
 
+#include "BackendFactory.h"
 #include "MapFileParser.h"
 #include "UnifiedBackendTest.h"
 #include <sys/file.h>
@@ -266,4 +267,31 @@ BOOST_AUTO_TEST_CASE(testUnified) {
 
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testSpinningWithRealtimePriority) {
+  // A spinning SCHED_FIFO interrupt thread would starve other threads, so the combination is refused
+  auto& factory = BackendFactory::getInstance();
+  BOOST_CHECK_THROW(
+      factory.createBackend("(uio:ctkuiodummy?map=uioBackendTest.mapp&interruptSpinTime=10&interruptPriority=50)"),
+      ChimeraTK::logic_error);
+  BOOST_CHECK_NO_THROW(
+      factory.createBackend("(uio:ctkuiodummy?map=uioBackendTest.mapp&interruptSpinTime=0&interruptPriority=50)"));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidParameters) {
+  auto& factory = BackendFactory::getInstance();
+  for(const std::string parameter : {"interruptSpinTime=-1", "interruptSpinTime=10us", "interruptSpinTime=10001",
+          "interruptSpinTime=4294967306", "interruptCpu=-1", "interruptCpu=1x", "interruptPriority=0",
+          "interruptPriority=100"}) {
+    BOOST_TEST_CONTEXT(parameter) {
+      BOOST_CHECK_THROW(factory.createBackend("(uio:ctkuiodummy?map=uioBackendTest.mapp&" + parameter + ")"),
+          ChimeraTK::logic_error);
+    }
+  }
+  BOOST_CHECK_NO_THROW(factory.createBackend("(uio:ctkuiodummy?map=uioBackendTest.mapp&interruptSpinTime=10000)"));
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_SUITE_END()
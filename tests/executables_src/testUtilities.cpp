@@ -152,6 +152,31 @@ BOOST_AUTO_TEST_CASE(testParseCDD) {
 }
 /**********************************************************************************************************************/
 
+BOOST_AUTO_TEST_CASE(testParseIntegerParameter) {
+  BOOST_CHECK_EQUAL(Utilities::parseIntegerParameter("p", "0"), 0U);
+  BOOST_CHECK_EQUAL(Utilities::parseIntegerParameter("p", "4096"), 4096U);
+  BOOST_CHECK_EQUAL(Utilities::parseIntegerParameter("p", "007", 7, 7), 7U);
+  BOOST_CHECK_EQUAL(Utilities::parseIntegerParameter("p", "18446744073709551615"), std::numeric_limits<size_t>::max());
+
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", ""), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "x"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "-1"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "+1"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", " 1"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "1 "), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "12kB"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "0x10"), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "18446744073709551616"), ChimeraTK::logic_error);
+
+  // range
+  BOOST_CHECK_EQUAL(Utilities::parseIntegerParameter("p", "1", 1, 99), 1U);
+  BOOST_CHECK_EQUAL(Utilities::parseIntegerParameter("p", "99", 1, 99), 99U);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "0", 1, 99), ChimeraTK::logic_error);
+  BOOST_CHECK_THROW(Utilities::parseIntegerParameter("p", "100", 1, 99), ChimeraTK::logic_error);
+}
+
+/**********************************************************************************************************************/
+
 BOOST_AUTO_TEST_CASE(testParseSdm) {
   Sdm sdm = Utilities::parseSdm(VALID_SDM);
   BOOST_CHECK(sdm.host == ".");
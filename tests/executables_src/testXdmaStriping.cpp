@@ -0,0 +1,230 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE XdmaStripingTest
+#include <boost/test/unit_test.hpp>
+using namespace boost::unit_test_framework;
+
+#include "Device.h"
+#include "ThreadPool.h"
+#include "TransferGroup.h"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <set>
+#include <vector>
+
+using namespace ChimeraTK;
+
+/**********************************************************************************************************************/
+
+// Directory of regular files which replace the device nodes of the XDMA driver. The c2h files of all channels contain
+// the word index, tagged with the channel number in the upper 4 bits, so the reassembled data tells which channel has
+// transferred which word.
+struct Fixture {
+  static constexpr size_t nChannels = 3;
+  static constexpr size_t nWords = 65536;
+
+  Fixture() {
+    boost::filesystem::remove_all(directory);
+    boost::filesystem::create_directory(directory);
+    writeFile("user", std::vector<int32_t>(1024, 0));
+    for(size_t channel = 0; channel < nChannels; ++channel) {
+      std::vector<int32_t> contents(nWords);
+      for(size_t i = 0; i < nWords; ++i) {
+        contents[i] = int32_t(channel << 28U | i);
+      }
+      writeFile("c2h" + std::to_string(channel), contents);
+      writeFile("h2c" + std::to_string(channel), {});
+    }
+  }
+
+  ~Fixture() { boost::filesystem::remove_all(directory); }
+
+  void writeFile(const std::string& name, const std::vector<int32_t>& contents) {
+    std::ofstream file((directory / name).string(), std::ios::binary);
+    file.write(reinterpret_cast<const char*>(contents.data()), std::streamsize(contents.size() * sizeof(int32_t)));
+  }
+
+  std::vector<int32_t> readFile(const std::string& name) {
+    std::ifstream file((directory / name).string(), std::ios::binary);
+    std::vector<int32_t> contents(nWords, 0);
+    file.read(reinterpret_cast<char*>(contents.data()), std::streamsize(contents.size() * sizeof(int32_t)));
+    return contents;
+  }
+
+  std::string cdd(const std::string& parameters) {
+    return "(xdma:" + directory.string() + "?map=testXdmaStriping.map" + parameters + ")";
+  }
+
+  // Read the register and return the channels which have transferred parts of it. Checks that every word is in place.
+  std::set<size_t> readAndGetChannels(Device& device, const std::string& registerName) {
+    auto accessor = device.getOneDRegisterAccessor<int32_t>(registerName);
+    accessor.read();
+    return getChannels(accessor);
+  }
+
+  // Return the channels which have transferred the data of the accessor and check that every word is in place.
+  std::set<size_t> getChannels(OneDRegisterAccessor<int32_t>& accessor) {
+    size_t offset = accessor.getNElements() == nWords ? 0 : 1024; // SMALL is at byte address 4096
+    std::set<size_t> channels;
+    for(size_t i = 0; i < accessor.getNElements(); ++i) {
+      BOOST_CHECK_EQUAL(uint32_t(accessor[i]) & 0x0FFFFFFFU, offset + i);
+      channels.insert(uint32_t(accessor[i]) >> 28U);
+    }
+    return channels;
+  }
+
+  boost::filesystem::path directory{boost::filesystem::absolute("xdmaStripingTestDevice")};
+};
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testStripedRead, Fixture) {
+  Device device(cdd("&dmaStripeSize=4096"));
+  device.open();
+
+  // 64 stripes are distributed to the 3 channels
+  BOOST_CHECK(readAndGetChannels(device, "/AREA") == std::set<size_t>({0, 1, 2}));
+  BOOST_CHECK(readAndGetChannels(device, "/AREA2") == std::set<size_t>({0, 1, 2}));
+
+  // not larger than one stripe
+  BOOST_CHECK(readAndGetChannels(device, "/SMALL") == std::set<size_t>({0}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testStripedWrite, Fixture) {
+  Device device(cdd("&dmaStripeSize=4096"));
+  device.open();
+
+  auto area = device.getOneDRegisterAccessor<int32_t>("/AREA");
+  for(size_t i = 0; i < nWords; ++i) {
+    area[i] = int32_t(i + 1);
+  }
+  area.write();
+
+  // each word has been written by exactly one channel, and all channels took part
+  std::vector<std::vector<int32_t>> written;
+  for(size_t channel = 0; channel < nChannels; ++channel) {
+    written.push_back(readFile("h2c" + std::to_string(channel)));
+  }
+  std::set<size_t> channels;
+  for(size_t i = 0; i < nWords; ++i) {
+    size_t nWritten = 0;
+    for(size_t channel = 0; channel < nChannels; ++channel) {
+      if(written[channel][i] != 0) {
+        BOOST_CHECK_EQUAL(written[channel][i], int32_t(i + 1));
+        channels.insert(channel);
+        ++nWritten;
+      }
+    }
+    BOOST_CHECK_EQUAL(nWritten, 1);
+  }
+  BOOST_CHECK_EQUAL(channels.size(), nChannels);
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testWithoutStriping, Fixture) {
+  Device device(cdd(""));
+  device.open();
+
+  // each bar uses its own channel only
+  BOOST_CHECK(readAndGetChannels(device, "/AREA") == std::set<size_t>({0}));
+  BOOST_CHECK(readAndGetChannels(device, "/AREA2") == std::set<size_t>({1}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testSingleChannel, Fixture) {
+  boost::filesystem::remove(directory / "c2h1");
+  Device device(cdd("&dmaStripeSize=4096"));
+  device.open();
+  BOOST_CHECK(readAndGetChannels(device, "/AREA") == std::set<size_t>({0}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testReadFromThreadPool, Fixture) {
+  Device device(cdd("&dmaStripeSize=4096"));
+  device.open();
+
+  // Worker threads of a ThreadPool would execute the pieces one after another, so the transfer is not striped
+  ThreadPool pool(1);
+  std::set<size_t> channels;
+  pool.submit([&] { channels = readAndGetChannels(device, "/AREA"); }).get();
+  BOOST_CHECK(channels == std::set<size_t>({0}));
+
+  // striping is still used from other threads
+  BOOST_CHECK(readAndGetChannels(device, "/AREA") == std::set<size_t>({0, 1, 2}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testTransferGroupWithIoUring, Fixture) {
+  Device device(cdd("&ioUring=1"));
+  device.open();
+
+  // the reads of both bars are submitted together, each on its own channel
+  auto area = device.getOneDRegisterAccessor<int32_t>("/AREA");
+  auto area2 = device.getOneDRegisterAccessor<int32_t>("/AREA2");
+  auto small = device.getOneDRegisterAccessor<int32_t>("/SMALL");
+  TransferGroup group;
+  group.addAccessor(area);
+  group.addAccessor(area2);
+  group.addAccessor(small);
+  group.read();
+  BOOST_CHECK(getChannels(area) == std::set<size_t>({0}));
+  BOOST_CHECK(getChannels(area2) == std::set<size_t>({1}));
+  BOOST_CHECK(getChannels(small) == std::set<size_t>({0}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testTransferGroupWithIoUringAndStriping, Fixture) {
+  Device device(cdd("&ioUring=1&dmaStripeSize=4096"));
+  device.open();
+
+  // all pieces of both reads are submitted together
+  auto area = device.getOneDRegisterAccessor<int32_t>("/AREA");
+  auto area2 = device.getOneDRegisterAccessor<int32_t>("/AREA2");
+  TransferGroup group;
+  group.addAccessor(area);
+  group.addAccessor(area2);
+  group.read();
+  BOOST_CHECK(getChannels(area) == std::set<size_t>({0, 1, 2}));
+  BOOST_CHECK(getChannels(area2) == std::set<size_t>({0, 1, 2}));
+}
+
+/**********************************************************************************************************************/
+
+BOOST_FIXTURE_TEST_CASE(testTransferGroupWithIoUringError, Fixture) {
+  Device device(cdd("&ioUring=1"));
+  device.open();
+
+  // the data for AREA2 is incomplete
+  boost::filesystem::resize_file(directory / "c2h1", 1024);
+  auto area = device.getOneDRegisterAccessor<int32_t>("/AREA");
+  auto area2 = device.getOneDRegisterAccessor<int32_t>("/AREA2");
+  TransferGroup group;
+  group.addAccessor(area);
+  group.addAccessor(area2);
+  BOOST_CHECK_THROW(group.read(), ChimeraTK::runtime_error);
+  BOOST_CHECK(!device.isFunctional());
+}
+
+/**********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE(testInvalidParameters) {
+  BOOST_CHECK_THROW(Device("(xdma:xdma/slot0?map=testXdmaStriping.map&dmaStripeSize=x)"), logic_error);
+  BOOST_CHECK_THROW(Device("(xdma:xdma/slot0?map=testXdmaStriping.map&dmaStripeSize=6)"), logic_error);
+  BOOST_CHECK_THROW(Device("(xdma:xdma/slot0?map=testXdmaStriping.map&dmaStripeSize=-4)"), logic_error);
+  BOOST_CHECK_THROW(Device("(xdma:xdma/slot0?map=testXdmaStriping.map&dmaStripeSize=4k)"), logic_error);
+  BOOST_CHECK_THROW(Device("(xdma:xdma/slot0?map=testXdmaStriping.map&dmaStripeSize=1073741824)"), logic_error);
+  BOOST_CHECK_THROW(Device("(xdma:xdma/slot0?map=testXdmaStriping.map&ioUring=2)"), logic_error);
+}
+
+/**********************************************************************************************************************/
@@ -5,17 +5,20 @@
 #define BOOST_TEST_MODULE SharedDummyBackendTest
 #include "Device.h"
 #include "ProcessManagement.h"
+#include "SharedDummyBackend.h"
 #include "sharedDummyHelpers.h"
 #include "Utilities.h"
 
 #include <boost/filesystem.hpp>
 #include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
 #include <chrono>
 #include <csignal>
 #include <cstdlib>
+#include <functional>
 #include <string>
 #include <thread>
 #include <unistd.h>
@@ -170,6 +173,56 @@ namespace {
     }
   }
 
+  /**
+   * This test case is called several times in parallel from testConsistentReadsAcrossProcesses, which keeps writing
+   * the same value to all elements of FEATURE2/AREA3. It checks that the lock-free reads never see a partially
+   * written area.
+   */
+  BOOST_AUTO_TEST_CASE(testConsistentReads) {
+    setDMapFilePath("shareddummyTest.dmap");
+    Device dev;
+    dev.open("SHDMEMDEV");
+
+    auto area = dev.getOneDRegisterAccessor<int>("FEATURE2/AREA3");
+    size_t nTornReads = 0;
+    size_t nChanges = 0;
+    int lastValue = 0;
+    for(size_t i = 0; i < 20000; ++i) {
+      area.read();
+      if(std::adjacent_find(area.begin(), area.end(), std::not_equal_to<>()) != area.end()) {
+        ++nTornReads;
+      }
+      if(i > 0 && area[0] != lastValue) {
+        ++nChanges;
+      }
+      lastValue = area[0];
+    }
+    BOOST_CHECK_EQUAL(nTornReads, 0);
+    // the other process has been writing during the test
+    BOOST_CHECK(nChanges > 0);
+
+    dev.close();
+  }
+
+  /**
+   * This test case is called twice in parallel from testConcurrentFirstInterrupts. Both processes trigger interrupt 1
+   * of a shared memory in which it has not been triggered before, starting at the same time. The start time is given
+   * in milliseconds since the epoch by the environment variable SHARED_DUMMY_TRIGGER_TIME.
+   */
+  BOOST_AUTO_TEST_CASE(testTriggerInterrupts) {
+    auto backend = boost::make_shared<SharedDummyBackend>(
+        "concurrentInterruptTest", boost::filesystem::canonical("sharedDummyUnified.map").string());
+
+    const char* triggerTime = std::getenv("SHARED_DUMMY_TRIGGER_TIME");
+    BOOST_REQUIRE(triggerTime != nullptr);
+    std::this_thread::sleep_until(
+        std::chrono::system_clock::time_point(std::chrono::milliseconds(std::stoll(triggerTime))));
+
+    for(size_t i = 0; i < 1000; ++i) {
+      backend->triggerInterrupt(1);
+    }
+  }
+
   /**
    * This test case implements a second application accessing the shared memory
    * for testing the ".DUMMY_WRITEABLE" feature.
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ChimeraTK::detail {
+
+  /********************************************************************************************************************/
+
+  /** A single pread() or pwrite() to be executed by IoUring::execute(). */
+  struct FileTransfer {
+    int fileDescriptor;
+    bool isWrite;
+    void* buffer;
+    size_t nBytes;
+    uint64_t offset;
+
+    /** Number of bytes transferred, or -errno if the transfer has failed. Set by IoUring::execute(). */
+    ssize_t result{0};
+  };
+
+  /********************************************************************************************************************/
+
+  /**
+   * Minimal io_uring submission queue for file transfers. It is used by backends to queue several DMA transfers to
+   * the driver at once, instead of blocking in one pread()/pwrite() after the other.
+   *
+   * If io_uring is not available (not supported by the kernel or the C library headers, or disabled by the system),
+   * the transfers are executed one after another with pread()/pwrite().
+   */
+  class IoUring {
+   public:
+    /** Create the ring with room for the given number of transfers in flight. */
+    explicit IoUring(unsigned queueDepth = 64);
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /** Check whether the transfers are submitted through io_uring, or executed by the pread()/pwrite() fallback. */
+    [[nodiscard]] bool isAvailable() const { return _ring != nullptr; }
+
+    /**
+     * Execute all transfers and block until all of them have completed. The transfers can be in flight concurrently,
+     * so they must not depend on each other. The result of each transfer is stored in FileTransfer::result, failed
+     * transfers are not reported otherwise.
+     *
+     * This function is thread safe. Calls from different threads are executed one after another.
+     *
+     * Throws ChimeraTK::runtime_error if io_uring fails unexpectedly. Before, it waits for the transfers which are
+     * already in flight, so the kernel does not access the buffers after returning. The ring is closed then and later
+     * calls use the pread()/pwrite() fallback. If even waiting fails, std::terminate() is called.
+     */
+    void execute(std::vector<FileTransfer>& transfers);
+
+   private:
+    struct Ring;
+
+    /** Submit up to one ring size of transfers and wait for their completion */
+    void submitAndWait(FileTransfer* transfers, size_t nTransfers);
+
+    std::unique_ptr<Ring> _ring;
+    std::mutex _mutex;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
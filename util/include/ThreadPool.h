@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  /**
+   * Simple fixed-size pool of worker threads, used internally to execute independent pieces of work (e.g. transfers
+   * to different backends or the conversion of independent channels) concurrently.
+   *
+   * The pool is not meant for long-running or blocking-forever tasks. Tasks should complete within the time of a
+   * typical data transfer.
+   */
+  class ThreadPool {
+   public:
+    /** Create pool with the given number of worker threads. At least one thread is always created. */
+    explicit ThreadPool(size_t nThreads);
+
+    /** Stops all worker threads. Tasks which are already queued are still executed before the threads terminate. */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Queue a task for execution. The returned future becomes ready when the task has completed. Exceptions thrown by
+     * the task are stored in the future.
+     */
+    std::future<void> submit(std::function<void()> task);
+
+    /**
+     * Execute all given tasks and block until all of them have completed. The first task is executed in the calling
+     * thread, the others are distributed to the worker threads.
+     *
+     * If called from inside a worker thread of any ThreadPool, all tasks are executed sequentially in the calling
+     * thread. This avoids dead locks when tasks which are already executed by the pool try to parallelise their work.
+     *
+     * If any of the tasks throws, the exception of the first task (in the order of the given vector) is re-thrown
+     * after all tasks have completed.
+     */
+    void runAll(const std::vector<std::function<void()>>& tasks);
+
+    /** Return number of worker threads. */
+    [[nodiscard]] size_t size() const { return _workers.size(); }
+
+    /** Check whether the calling thread is a worker thread of any ThreadPool. */
+    static bool isWorkerThread() { return _isWorkerThread; }
+
+    /**
+     * Obtain the process-wide pool shared by all library-internal users. It is created on first use with one thread
+     * per hardware thread.
+     */
+    static ThreadPool& shared();
+
+   private:
+    void workerLoop();
+
+    std::vector<std::thread> _workers;
+    std::deque<std::packaged_task<void()>> _queue;
+    std::mutex _queueMutex;
+    std::condition_variable _queueCondition;
+    bool _shutdown{false};
+
+    static thread_local bool _isWorkerThread;
+  };
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
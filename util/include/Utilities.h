@@ -5,6 +5,7 @@
 #include "DeviceInfoMap.h"
 #include "Exception.h"
 
+#include <limits>
 #include <list>
 #include <map>
 
@@ -81,6 +82,12 @@ namespace ChimeraTK {
     /// @ref BackendFactory::setDMapFilePath
     std::vector<std::string> getAliasList();
 
+    /// Parse the value of the integer parameter with the given name (e.g. from a CDD) and check that it is in the
+    /// range [min, max]. Only decimal digits are accepted, so unlike std::stoul() negative numbers, signs, leading
+    /// white space and trailing characters are rejected. Throws a ChimeraTK::logic_error if the value is not valid.
+    size_t parseIntegerParameter(const std::string& name, const std::string& value, size_t min = 0,
+        size_t max = std::numeric_limits<size_t>::max());
+
     /// Print a call stack trace (but continue executing the process normally).
     /// Can be used for debugging. C++ names will be demangled, if possible.
     void printStackTrace();
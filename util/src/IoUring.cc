@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "IoUring.h"
+
+#include "Exception.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#  define CHIMERATK_USE_IO_URING
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <sys/uio.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <unistd.h>
+
+namespace ChimeraTK::detail {
+
+#ifdef CHIMERATK_USE_IO_URING
+
+  /********************************************************************************************************************/
+
+  /*
+   * The rings shared with the kernel. The C library does not provide wrappers for the io_uring system calls, and
+   * liburing is deliberately not used to avoid the additional dependency.
+   */
+  struct IoUring::Ring {
+    ~Ring() {
+      if(sqes != MAP_FAILED) ::munmap(sqes, sqesSize);
+      if(cqRing != MAP_FAILED && cqRing != sqRing) ::munmap(cqRing, cqRingSize);
+      if(sqRing != MAP_FAILED) ::munmap(sqRing, sqRingSize);
+      ::close(fd);
+    }
+
+    // Create the ring, return nullptr if io_uring is not available
+    static std::unique_ptr<Ring> create(unsigned queueDepth) {
+      io_uring_params params{};
+      int fd = static_cast<int>(::syscall(__NR_io_uring_setup, queueDepth, &params));
+      if(fd < 0) {
+        return nullptr;
+      }
+      auto ring = std::make_unique<Ring>();
+      ring->fd = fd;
+      ring->nEntries = params.sq_entries;
+
+      ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+      ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+      bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+      if(singleMmap) {
+        ring->sqRingSize = ring->cqRingSize = std::max(ring->sqRingSize, ring->cqRingSize);
+      }
+      ring->sqRing = ::mmap(nullptr, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+          IORING_OFF_SQ_RING);
+      if(ring->sqRing == MAP_FAILED) {
+        return nullptr;
+      }
+      if(singleMmap) {
+        ring->cqRing = ring->sqRing;
+      }
+      else {
+        ring->cqRing = ::mmap(nullptr, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+            IORING_OFF_CQ_RING);
+        if(ring->cqRing == MAP_FAILED) {
+          return nullptr;
+        }
+      }
+      ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+      ring->sqes = static_cast<io_uring_sqe*>(::mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE,
+          MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+      if(ring->sqes == MAP_FAILED) {
+        return nullptr;
+      }
+
+      auto* sq = static_cast<uint8_t*>(ring->sqRing);
+      ring->sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+      ring->sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+      ring->sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+      auto* cq = static_cast<uint8_t*>(ring->cqRing);
+      ring->cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+      ring->cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+      ring->cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+      ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+      return ring;
+    }
+
+    int fd{-1};
+    unsigned nEntries{0};
+
+    void* sqRing{MAP_FAILED};
+    size_t sqRingSize{0};
+    void* cqRing{MAP_FAILED};
+    size_t cqRingSize{0};
+    io_uring_sqe* sqes{static_cast<io_uring_sqe*>(MAP_FAILED)};
+    size_t sqesSize{0};
+
+    // The tails are written by the producer and the heads by the consumer, the other side reads them concurrently.
+    unsigned* sqTail{nullptr};
+    unsigned sqMask{0};
+    unsigned* sqArray{nullptr};
+    unsigned* cqHead{nullptr};
+    unsigned* cqTail{nullptr};
+    unsigned cqMask{0};
+    io_uring_cqe* cqes{nullptr};
+
+    std::vector<iovec> iovecs;
+  };
+
+  /********************************************************************************************************************/
+
+  IoUring::IoUring(unsigned queueDepth) : _ring(Ring::create(queueDepth)) {}
+
+  /********************************************************************************************************************/
+
+  void IoUring::submitAndWait(FileTransfer* transfers, size_t nTransfers) {
+    auto& ring = *_ring;
+    ring.iovecs.resize(nTransfers);
+
+    // Fill the submission queue. Only this thread writes the tail, so a relaxed load is sufficient.
+    unsigned tail = __atomic_load_n(ring.sqTail, __ATOMIC_RELAXED);
+    for(size_t i = 0; i < nTransfers; ++i) {
+      auto& transfer = transfers[i];
+      ring.iovecs[i] = {transfer.buffer, transfer.nBytes};
+      unsigned index = tail & ring.sqMask;
+      auto& sqe = ring.sqes[index];
+      std::memset(&sqe, 0, sizeof(sqe));
+      sqe.opcode = transfer.isWrite ? IORING_OP_WRITEV : IORING_OP_READV;
+      sqe.fd = transfer.fileDescriptor;
+      sqe.addr = reinterpret_cast<uint64_t>(&ring.iovecs[i]);
+      sqe.len = 1;
+      sqe.off = transfer.offset;
+      sqe.user_data = i;
+      ring.sqArray[index] = index;
+      ++tail;
+    }
+    __atomic_store_n(ring.sqTail, tail, __ATOMIC_RELEASE);
+
+    // Submit and reap the completions. The kernel writes the buffers until the completion has been seen, so all
+    // transfers must complete before returning.
+    size_t nToSubmit = nTransfers;
+    size_t nCompleted = 0;
+    auto reapCompletions = [&] {
+      unsigned head = __atomic_load_n(ring.cqHead, __ATOMIC_RELAXED);
+      while(head != __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE)) {
+        auto& cqe = ring.cqes[head & ring.cqMask];
+        transfers[cqe.user_data].result = cqe.res;
+        ++nCompleted;
+        ++head;
+      }
+      __atomic_store_n(ring.cqHead, head, __ATOMIC_RELEASE);
+    };
+    auto isTransientError = [] { return errno == EINTR || errno == EAGAIN || errno == EBUSY; };
+
+    while(nCompleted < nTransfers) {
+      auto ret = ::syscall(__NR_io_uring_enter, ring.fd, nToSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+      if(ret < 0) {
+        if(isTransientError()) {
+          continue;
+        }
+        // Not expected after a successful setup. A failed call has not submitted anything, but the transfers
+        // submitted before are still in flight and write to their buffers. Wait for them before the ring is closed
+        // and the error is reported. The transfers which have not been submitted are dropped with the ring, which
+        // cannot be used any more since its state is unknown. Later calls use the pread()/pwrite() fallback.
+        auto error = errno;
+        while(nCompleted < nTransfers - nToSubmit) {
+          if(::syscall(__NR_io_uring_enter, ring.fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+              !isTransientError()) {
+            // The kernel might still write to the buffers after returning, which cannot be made safe.
+            std::terminate();
+          }
+          reapCompletions();
+        }
+        _ring.reset();
+        throw ChimeraTK::runtime_error("io_uring_enter() failed: " + std::string(std::strerror(error)));
+      }
+      nToSubmit -= std::min(nToSubmit, static_cast<size_t>(ret));
+      reapCompletions();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+#else
+
+  struct IoUring::Ring {
+    unsigned nEntries{0};
+  };
+
+  IoUring::IoUring(unsigned) {}
+
+  void IoUring::submitAndWait(FileTransfer*, size_t) {}
+
+#endif
+
+  /********************************************************************************************************************/
+
+  IoUring::~IoUring() = default;
+
+  /********************************************************************************************************************/
+
+  void IoUring::execute(std::vector<FileTransfer>& transfers) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if(_ring) {
+      for(size_t first = 0; first < transfers.size(); first += _ring->nEntries) {
+        submitAndWait(transfers.data() + first, std::min(size_t(_ring->nEntries), transfers.size() - first));
+      }
+      return;
+    }
+
+    for(auto& transfer : transfers) {
+      transfer.result = transfer.isWrite ?
+          ::pwrite(transfer.fileDescriptor, transfer.buffer, transfer.nBytes, static_cast<off_t>(transfer.offset)) :
+          ::pread(transfer.fileDescriptor, transfer.buffer, transfer.nBytes, static_cast<off_t>(transfer.offset));
+      if(transfer.result < 0) {
+        transfer.result = -errno;
+      }
+    }
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK::detail
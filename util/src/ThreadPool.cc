@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Deutsches Elektronen-Synchrotron DESY, MSK, ChimeraTK Project <chimeratk-support@desy.de>
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace ChimeraTK {
+
+  /********************************************************************************************************************/
+
+  thread_local bool ThreadPool::_isWorkerThread{false};
+
+  /********************************************************************************************************************/
+
+  ThreadPool::ThreadPool(size_t nThreads) {
+    nThreads = std::max(nThreads, size_t(1));
+    _workers.reserve(nThreads);
+    for(size_t i = 0; i < nThreads; ++i) {
+      _workers.emplace_back([this] { workerLoop(); });
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  ThreadPool::~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(_queueMutex);
+      _shutdown = true;
+    }
+    _queueCondition.notify_all();
+    for(auto& worker : _workers) {
+      worker.join();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+  std::future<void> ThreadPool::submit(std::function<void()> task) {
+    std::packaged_task<void()> packagedTask(std::move(task));
+    auto future = packagedTask.get_future();
+    {
+      std::lock_guard<std::mutex> lock(_queueMutex);
+      _queue.push_back(std::move(packagedTask));
+    }
+    _queueCondition.notify_one();
+    return future;
+  }
+
+  /********************************************************************************************************************/
+
+  void ThreadPool::runAll(const std::vector<std::function<void()>>& tasks) {
+    if(tasks.empty()) return;
+
+    // Sequential execution inside worker threads (see documentation) and if there is nothing to parallelise.
+    if(_isWorkerThread || tasks.size() == 1) {
+      std::exception_ptr firstException{nullptr};
+      for(const auto& task : tasks) {
+        try {
+          task();
+        }
+        catch(...) {
+          if(!firstException) firstException = std::current_exception();
+        }
+      }
+      if(firstException) std::rethrow_exception(firstException);
+      return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(tasks.size() - 1);
+    for(size_t i = 1; i < tasks.size(); ++i) {
+      futures.push_back(submit(tasks[i]));
+    }
+
+    std::exception_ptr firstException{nullptr};
+    try {
+      tasks.front()();
+    }
+    catch(...) {
+      firstException = std::current_exception();
+    }
+
+    // always wait for all tasks, since they may refer to objects owned by the caller
+    for(auto& future : futures) {
+      try {
+        future.get();
+      }
+      catch(...) {
+        if(!firstException) firstException = std::current_exception();
+      }
+    }
+    if(firstException) std::rethrow_exception(firstException);
+  }
+
+  /********************************************************************************************************************/
+
+  ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool(std::thread::hardware_concurrency());
+    return pool;
+  }
+
+  /********************************************************************************************************************/
+
+  void ThreadPool::workerLoop() {
+    _isWorkerThread = true;
+    while(true) {
+      std::packaged_task<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(_queueMutex);
+        _queueCondition.wait(lock, [this] { return _shutdown || !_queue.empty(); });
+        if(_queue.empty()) return; // shutdown requested and no more work
+        task = std::move(_queue.front());
+        _queue.pop_front();
+      }
+      task();
+    }
+  }
+
+  /********************************************************************************************************************/
+
+} // namespace ChimeraTK
@@ -9,8 +9,10 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
 #include <cxxabi.h>
 #include <execinfo.h>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -330,6 +332,29 @@ namespace ChimeraTK {
 
   /********************************************************************************************************************/
 
+  size_t Utilities::parseIntegerParameter(const std::string& name, const std::string& value, size_t min, size_t max) {
+    // std::stoul() cannot be used alone, since it skips white space and accepts negative numbers, which are wrapped
+    // around
+    if(value.empty() || !std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+      throw ChimeraTK::logic_error("Invalid value for parameter '" + name + "': '" + value + "'");
+    }
+    size_t parsed = 0;
+    bool isRepresentable = true;
+    try {
+      parsed = std::stoul(value);
+    }
+    catch(std::out_of_range&) {
+      isRepresentable = false;
+    }
+    if(!isRepresentable || parsed < min || parsed > max) {
+      throw ChimeraTK::logic_error("Parameter '" + name + "' must be between " + std::to_string(min) + " and " +
+          std::to_string(max) + ": '" + value + "'");
+    }
+    return parsed;
+  }
+
+  /********************************************************************************************************************/
+
   void Utilities::printStackTrace() {
     void* trace[16];
     char** messages;